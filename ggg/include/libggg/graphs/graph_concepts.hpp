@@ -81,5 +81,30 @@ concept HasDiscountOnEdges = requires(const GraphType &graph,
     { graph[edge].discount } -> std::convertible_to<double>;
 };
 
+/**
+ * @brief C++20 concept for graphs that have weight properties on edges
+ *
+ * This concept requires that edges in the graph have a bundled property called
+ * "weight" of type double, as used for discounted games.
+ */
+template <typename GraphType>
+concept HasWeightOnEdges = requires(const GraphType &graph,
+                                    typename boost::graph_traits<GraphType>::edge_descriptor edge) {
+    { graph[edge].weight } -> std::convertible_to<double>;
+};
+
+/**
+ * @brief C++20 concept for graphs that have probability properties on edges
+ *
+ * This concept requires that edges in the graph have a bundled property called
+ * "probability" of type double, the chance of an edge leaving a chance vertex in
+ * stochastic games.
+ */
+template <typename GraphType>
+concept HasProbabilityOnEdges = requires(const GraphType &graph,
+                                         typename boost::graph_traits<GraphType>::edge_descriptor edge) {
+    { graph[edge].probability } -> std::convertible_to<double>;
+};
+
 } // namespace graphs
 } // namespace ggg
@@ -11,7 +11,7 @@ namespace ggg {
 namespace graphs {
 
 // --- Helper macros for property struct field generation ---
-#define PROPERTY_STRUCT_FIELD(type, name) type name;
+#define PROPERTY_STRUCT_FIELD(type, name) type name{};
 
 // These macros work within the context of register_*_dynamic_properties functions
 // where dp, g, and Props are in scope
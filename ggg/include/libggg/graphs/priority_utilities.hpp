@@ -106,6 +106,32 @@ inline std::vector<int> get_unique_priorities(const GraphType &graph) {
     return unique_priorities;
 }
 
+/**
+ * @brief Count the priorities compress_priorities would leave, without modifying the graph
+ *
+ * Compression keeps one priority per run of equal parity in the sorted priorities, so
+ * the count is one plus the number of parity changes; it classifies games, e.g. 2 for
+ * Buchi-like and 1 for trivial parity games.
+ *
+ * @tparam GraphType Any graph type satisfying HasPriorityOnVertices concept
+ * @param graph The graph to analyze
+ * @return Number of compressed priorities, or 0 if graph is empty
+ */
+template <HasPriorityOnVertices GraphType>
+inline int get_compressed_priority_count(const GraphType &graph) {
+    const auto unique_priorities = get_unique_priorities(graph);
+    int count = 0;
+    int last_parity = -1;
+    for (int priority : unique_priorities) {
+        const int parity = priority % 2;
+        if (parity != last_parity) {
+            count++;
+            last_parity = parity;
+        }
+    }
+    return count;
+}
+
 /**
  * @brief Compress priority values in the given graph in-place
  *
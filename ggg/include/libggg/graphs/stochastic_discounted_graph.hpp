@@ -47,16 +47,18 @@ struct VertexFilter {
     VertexFilter(const Stochastic_DiscountedGraph &graph) : g(&graph) {}
 
     bool operator()(Stochastic_DiscountedGraph::vertex_descriptor v) const {
-        return (*g)[v].player == 1;
+        return (*g)[v].player == -1;
     }
 };
 
 struct CycleDetector : public boost::dfs_visitor<> {
-    bool has_cycle = false;
+    bool *has_cycle; // The search copies its visitor, so the flag lives with the caller
+
+    explicit CycleDetector(bool &flag) : has_cycle(&flag) {}
 
     template <typename Edge, typename Graph>
     void back_edge(Edge, const Graph &) {
-        has_cycle = true;
+        *has_cycle = true;
     }
 };
 
@@ -77,7 +79,7 @@ inline Stochastic_DiscountedVertex find_vertex(const Stochastic_DiscountedGraph
  *   - Each edge having source vertex of player 0 or 1 has weight and a discount factor in the range (0.0, 1.0).
  *   - Each edge having source vertex of player -1 has a probability in the range (0.0, 1.0].
  *   - The sum of the probability of the edges having source vertex of player -1 sum up to 1.
- *   - TODO There are no loops among vertices of player -1.
+ *   - There are no loops among vertices of player -1.
  *
  * @param graph The Stochastic_DiscountedGraph to validate.
  * @return true if the graph is valid, false otherwise.
@@ -130,9 +132,9 @@ inline bool is_valid(const Stochastic_DiscountedGraph &graph) {
 
     // Check loop probability
     auto filtered_graph = boost::make_filtered_graph(graph, boost::keep_all{}, VertexFilter(graph));
-    CycleDetector vis;
-    boost::depth_first_search(filtered_graph, boost::visitor(vis));
-    if (vis.has_cycle) {
+    bool has_cycle = false;
+    boost::depth_first_search(filtered_graph, boost::visitor(CycleDetector(has_cycle)));
+    if (has_cycle) {
         return false;
     }
 
@@ -0,0 +1,421 @@
+#pragma once
+
+#include "libggg/solvers/bitsliced.hpp"
+#include <algorithm>
+#include <bit>
+#include <cmath>
+#include <cstdint>
+#include <optional>
+#include <random>
+#include <string>
+#include <vector>
+
+namespace ggg {
+namespace ownership {
+
+/**
+ * @brief Ways of drawing ownership assignments for the sampler
+ *
+ * Every design draws each vertex owner uniformly at random marginally, so the win
+ * frequency stays unbiased; the non-i.i.d. designs correlate the assignments within a
+ * block so that monotone outcomes vary less between blocks.
+ */
+enum class Design {
+    Iid,        ///< Independent uniform bitstrings
+    Antithetic, ///< Pairs of a uniform bitstring and its complement
+    Balanced,   ///< Every vertex owned by player 1 in exactly half of each 64-sample block
+    Sobol       ///< First digits of a digitally shifted Sobol sequence, one dimension per vertex
+};
+
+/**
+ * @brief Parse a design name (iid, antithetic, balanced, sobol)
+ * @return Design, or empty if the name is unknown
+ */
+inline std::optional<Design> parse_design(const std::string &name) {
+    if (name == "iid") {
+        return Design::Iid;
+    }
+    if (name == "antithetic") {
+        return Design::Antithetic;
+    }
+    if (name == "balanced") {
+        return Design::Balanced;
+    }
+    if (name == "sobol") {
+        return Design::Sobol;
+    }
+    return std::nullopt;
+}
+
+/**
+ * @brief Name of a design as accepted by parse_design
+ */
+inline std::string to_string(Design design) {
+    switch (design) {
+    case Design::Iid:
+        return "iid";
+    case Design::Antithetic:
+        return "antithetic";
+    case Design::Balanced:
+        return "balanced";
+    case Design::Sobol:
+        return "sobol";
+    }
+    return "";
+}
+
+namespace detail {
+
+/**
+ * @brief Multiply two polynomials over GF(2) modulo a polynomial of degree degree
+ */
+inline std::uint64_t multiply_mod(std::uint64_t a, std::uint64_t b, std::uint64_t modulus, int degree) {
+    std::uint64_t product = 0;
+    while (b != 0) {
+        if (b & 1) {
+            product ^= a;
+        }
+        b >>= 1;
+        a <<= 1;
+        if ((a >> degree) & 1) {
+            a ^= modulus;
+        }
+    }
+    return product;
+}
+
+/**
+ * @brief x^exponent modulo a polynomial of degree degree over GF(2)
+ */
+inline std::uint64_t power_of_x(std::uint64_t exponent, std::uint64_t modulus, int degree) {
+    std::uint64_t result = 1;
+    std::uint64_t base = degree == 1 ? (2 ^ modulus) : 2;
+    while (exponent != 0) {
+        if (exponent & 1) {
+            result = multiply_mod(result, base, modulus, degree);
+        }
+        base = multiply_mod(base, base, modulus, degree);
+        exponent >>= 1;
+    }
+    return result;
+}
+
+/**
+ * @brief Whether a polynomial of degree degree (bit i = coefficient of x^i) is primitive over GF(2)
+ */
+inline bool is_primitive(std::uint64_t polynomial, int degree) {
+    if ((polynomial & 1) == 0) {
+        return false;
+    }
+    const std::uint64_t order = (std::uint64_t(1) << degree) - 1;
+    if (power_of_x(order, polynomial, degree) != 1) {
+        return false;
+    }
+    std::uint64_t rest = order;
+    for (std::uint64_t q = 2; q * q <= rest; ++q) {
+        if (rest % q != 0) {
+            continue;
+        }
+        if (power_of_x(order / q, polynomial, degree) == 1) {
+            return false;
+        }
+        while (rest % q == 0) {
+            rest /= q;
+        }
+    }
+    return rest == 1 || rest == order || power_of_x(order / rest, polynomial, degree) != 1;
+}
+
+/**
+ * @brief Generator rows of the first digit of Sobol dimensions 0 .. count - 1
+ *
+ * The first binary digit of Sobol point i in dimension d is the parity of i & row[d]:
+ * bit k - 1 of the row is the leading bit of direction number v_k. Dimension 0 is the
+ * van der Corput sequence; dimension d >= 1 uses the d-th primitive polynomial and
+ * follows the Sobol recurrence, whose leading bits satisfy
+ * t_k = a_1 t_{k-1} ^ ... ^ a_{s-1} t_{k-s+1} ^ t_{k-s}. The free initial bits t_2 .. t_s
+ * are fixed by a hash of the dimension (any odd initial direction numbers give a valid
+ * Sobol sequence).
+ *
+ * @param count Number of dimensions
+ * @param bits Number of low index bits kept per row
+ */
+inline std::vector<std::uint64_t> sobol_first_digit_rows(std::size_t count, int bits) {
+    std::vector<std::uint64_t> rows;
+    if (count == 0) {
+        return rows;
+    }
+    rows.push_back(1);
+
+    for (int degree = 1; rows.size() < count && degree < 63; ++degree) {
+        for (std::uint64_t polynomial = (std::uint64_t(1) << degree) | 1;
+             polynomial < (std::uint64_t(1) << (degree + 1)) && rows.size() < count; polynomial += 2) {
+            if (!is_primitive(polynomial, degree)) {
+                continue;
+            }
+            std::uint64_t hash = rows.size() * 0x9E3779B97F4A7C15ull;
+            hash ^= hash >> 29;
+            std::vector<int> t(bits + 1, 0);
+            t[1] = 1;
+            for (int k = 2; k <= std::min(degree, bits); ++k) {
+                t[k] = static_cast<int>((hash >> k) & 1);
+            }
+            for (int k = degree + 1; k <= bits; ++k) {
+                int next = t[k - degree];
+                for (int j = 1; j < degree; ++j) {
+                    next ^= static_cast<int>((polynomial >> (degree - j)) & 1) & t[k - j];
+                }
+                t[k] = next;
+            }
+            std::uint64_t row = 0;
+            for (int k = 1; k <= bits; ++k) {
+                row |= std::uint64_t(t[k]) << (k - 1);
+            }
+            rows.push_back(row);
+        }
+    }
+    return rows;
+}
+
+} // namespace detail
+
+/**
+ * @brief Generator of ownership assignments, 64 lanes at a time
+ *
+ * Assignments are grouped into blocks: single samples for i.i.d. draws, complementary
+ * pairs (lanes 2k and 2k + 1) for antithetic draws, one batch of 64 for balanced draws,
+ * and 2^m consecutive Sobol points for the Sobol design, with m large enough for every
+ * vertex to have its own generator row where possible. Balanced batches draw, per vertex,
+ * random words until exactly half of the batch lanes are set. Sobol blocks get a fresh
+ * random digital shift per vertex, which keeps every owner uniform and makes blocks
+ * independent replicates; within a block every owner is player 1 in exactly half of the
+ * points and owners with distinct generator rows are pairwise independent.
+ */
+class OwnershipDesign {
+  public:
+    /**
+     * @brief Create a generator
+     * @param design Sampling design
+     * @param num_vertices Number of vertices
+     * @param seed Random seed
+     */
+    OwnershipDesign(Design design, int num_vertices, std::uint64_t seed)
+        : design_(design), num_vertices_(num_vertices), rng_(seed) {
+        if (design_ == Design::Sobol) {
+            sobol_bits_ = 6;
+            while (sobol_bits_ < 16 && (std::size_t(1) << (sobol_bits_ - 1)) < static_cast<std::size_t>(num_vertices)) {
+                ++sobol_bits_;
+            }
+            rows_ = detail::sobol_first_digit_rows(num_vertices, sobol_bits_);
+            for (int g = 0; g < solvers::bitsliced::lane_count; ++g) {
+                solvers::bitsliced::Lanes word = 0;
+                for (int lane = 0; lane < solvers::bitsliced::lane_count; ++lane) {
+                    word |= solvers::bitsliced::Lanes(std::popcount(static_cast<unsigned>(lane & g)) & 1) << lane;
+                }
+                walsh_[g] = word;
+            }
+            shifts_.resize(num_vertices, 0);
+        }
+    }
+
+    Design design() const { return design_; }
+
+    /**
+     * @brief Number of consecutive samples that form one block of the design
+     */
+    long block_size() const {
+        switch (design_) {
+        case Design::Iid:
+            return 1;
+        case Design::Antithetic:
+            return 2;
+        case Design::Balanced:
+            return solvers::bitsliced::lane_count;
+        case Design::Sobol:
+            return long(1) << sobol_bits_;
+        }
+        return 1;
+    }
+
+    /**
+     * @brief Draw the next batch of assignments
+     *
+     * Batches must hold 64 lanes except for the last one, so that blocks never straddle
+     * a short batch.
+     *
+     * @param player1 Output: player 1 vertices per lane
+     * @param lanes Lanes to fill (a prefix of the 64 lanes)
+     * @param pinned Vertices left with player 0 in every lane (may be empty)
+     */
+    void draw(solvers::bitsliced::SlicedSet &player1, solvers::bitsliced::Lanes lanes, const std::vector<char> &pinned) {
+        using solvers::bitsliced::Lanes;
+        player1.resize(num_vertices_);
+        if (design_ == Design::Sobol && position_ == 0) {
+            for (auto &shift : shifts_) {
+                shift = rng_() & 1 ? ~Lanes(0) : 0;
+            }
+        }
+
+        const int batch = std::popcount(lanes);
+        for (int v = 0; v < num_vertices_; ++v) {
+            Lanes word = 0;
+            switch (design_) {
+            case Design::Iid:
+                word = rng_();
+                break;
+            case Design::Antithetic: {
+                const Lanes even = rng_() & 0x5555555555555555ull;
+                word = even | ((~even & 0x5555555555555555ull) << 1);
+                break;
+            }
+            case Design::Balanced: {
+                int wanted = batch / 2;
+                if (batch % 2 == 1) {
+                    wanted += static_cast<int>(rng_() & 1);
+                }
+                do {
+                    word = rng_() & lanes;
+                } while (std::popcount(word) != wanted);
+                break;
+            }
+            case Design::Sobol: {
+                const std::uint64_t row = rows_[v];
+                const Lanes high = std::popcount(row & static_cast<std::uint64_t>(position_) & ~std::uint64_t(63)) & 1
+                                       ? ~Lanes(0)
+                                       : 0;
+                word = walsh_[row & 63] ^ high ^ shifts_[v];
+                break;
+            }
+            }
+            player1[v] = !pinned.empty() && pinned[v] ? 0 : word & lanes;
+        }
+
+        if (design_ == Design::Sobol) {
+            position_ = (position_ + solvers::bitsliced::lane_count) % block_size();
+        }
+    }
+
+  private:
+    Design design_;
+    int num_vertices_;
+    std::mt19937_64 rng_;
+    int sobol_bits_ = 0;
+    long position_ = 0;
+    std::vector<std::uint64_t> rows_;
+    std::vector<solvers::bitsliced::Lanes> shifts_;
+    solvers::bitsliced::Lanes walsh_[solvers::bitsliced::lane_count] = {};
+};
+
+/**
+ * @brief Win-frequency estimator with a between-block variance
+ *
+ * Outcomes are fed in sample order and grouped into blocks of the design's size (the
+ * last block may be shorter). The estimate is wins / samples, and its variance is the
+ * ratio-estimator variance over blocks,
+ * B / (B - 1) * sum_b (w_b - p n_b)^2 / N^2,
+ * which for blocks of one sample is the usual Bernoulli p (1 - p) / (N - 1).
+ */
+class BlockEstimator {
+  public:
+    explicit BlockEstimator(long block_size = 1) : block_size_(std::max(block_size, 1L)) {}
+
+    /**
+     * @brief Add the outcomes of the first count lanes (bit set = player 0 wins)
+     */
+    void add(solvers::bitsliced::Lanes won, int count) {
+        if (block_size_ == 1) {
+            const long wins = std::popcount(won & solvers::bitsliced::first_lanes(count));
+            wins_ += wins;
+            samples_ += count;
+            sum_w2_ += wins;
+            sum_wn_ += wins;
+            sum_n2_ += count;
+            blocks_ += count;
+            return;
+        }
+        for (int lane = 0; lane < count; ++lane) {
+            block_wins_ += (won >> lane) & 1;
+            if (++block_samples_ == block_size_) {
+                close_block();
+            }
+        }
+    }
+
+    /**
+     * @brief Close the current partial block; call once all outcomes are added
+     */
+    void finish() {
+        if (block_samples_ > 0) {
+            close_block();
+        }
+    }
+
+    /**
+     * @brief Absorb a finished estimator with the same block size
+     */
+    void merge(const BlockEstimator &other) {
+        wins_ += other.wins_;
+        samples_ += other.samples_;
+        blocks_ += other.blocks_;
+        sum_w2_ += other.sum_w2_;
+        sum_wn_ += other.sum_wn_;
+        sum_n2_ += other.sum_n2_;
+    }
+
+    long wins() const { return wins_; }
+    long samples() const { return samples_; }
+    long blocks() const { return blocks_; }
+
+    double estimate() const { return samples_ == 0 ? 0.0 : static_cast<double>(wins_) / static_cast<double>(samples_); }
+
+    /**
+     * @brief Between-block variance of the estimate (0 with fewer than two blocks)
+     */
+    double variance() const {
+        if (blocks_ < 2) {
+            return 0.0;
+        }
+        const double p = estimate();
+        const double spread = std::max(0.0, sum_w2_ - 2.0 * p * sum_wn_ + p * p * sum_n2_);
+        const double n = static_cast<double>(samples_);
+        return static_cast<double>(blocks_) / static_cast<double>(blocks_ - 1) * spread / (n * n);
+    }
+
+    double standard_error() const { return std::sqrt(variance()); }
+
+    /**
+     * @brief Variance relative to i.i.d. sampling with as many samples (below 1 means fewer solves are needed)
+     */
+    double design_effect() const {
+        const double p = estimate();
+        const double iid = p * (1.0 - p) / static_cast<double>(samples_);
+        return iid > 0.0 ? variance() / iid : 1.0;
+    }
+
+  private:
+    long block_size_;
+    long wins_ = 0;
+    long samples_ = 0;
+    long blocks_ = 0;
+    double sum_w2_ = 0.0;
+    double sum_wn_ = 0.0;
+    double sum_n2_ = 0.0;
+    long block_wins_ = 0;
+    long block_samples_ = 0;
+
+    void close_block() {
+        const double w = static_cast<double>(block_wins_);
+        const double n = static_cast<double>(block_samples_);
+        wins_ += block_wins_;
+        samples_ += block_samples_;
+        blocks_++;
+        sum_w2_ += w * w;
+        sum_wn_ += w * n;
+        sum_n2_ += n * n;
+        block_wins_ = 0;
+        block_samples_ = 0;
+    }
+};
+
+} // namespace ownership
+} // namespace ggg
@@ -0,0 +1,361 @@
+#pragma once
+
+#include "libggg/ownership/objective.hpp"
+#include "libggg/ownership/tree_decomposition.hpp"
+#include "libggg/solvers/bitsliced.hpp"
+#include <boost/multiprecision/cpp_int.hpp>
+#include <algorithm>
+#include <bit>
+#include <cstdint>
+#include <map>
+#include <optional>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+namespace ggg {
+namespace ownership {
+
+/**
+ * @brief Exact number of ownership assignments (grows like 2^n)
+ */
+using Count = boost::multiprecision::cpp_int;
+
+/**
+ * @brief Outcome of an exact win-probability computation
+ *
+ * Every vertex is owned by player 0 or player 1 with probability 1/2 independently,
+ * so the probability is wins / total with total = 2^n.
+ */
+struct ExactResult {
+    Count wins = 0;     ///< Assignments where player 0 wins from the query vertex
+    Count total = 0;    ///< Number of assignments
+    Count solved = 0;   ///< Assignments actually solved (0 if none were solved one by one)
+    std::string engine; ///< Engine that produced the counts
+    int width = -1;     ///< Width of the tree decomposition used or attempted (-1 if none)
+
+    /**
+     * @brief Winning probability of player 0
+     */
+    double probability() const {
+        return total == 0 ? 0.0 : static_cast<double>(wins) / static_cast<double>(total);
+    }
+};
+
+/**
+ * @brief Largest arena accepted by exhaustive enumeration
+ */
+inline constexpr int max_enumeration_vertices = 40;
+
+/**
+ * @brief Count winning assignments by solving all of them, 64 per bitsliced pass
+ *
+ * Only the owners of vertices not marked in pinned are enumerated; pinned vertices stay
+ * with player 0 and every count is multiplied by 2 per pinned vertex, which is exact when
+ * their owners do not matter (see irrelevant_vertices). Lane l of pass b is the
+ * assignment with index 64 b + l; bit i of the index is the owner of the i-th free
+ * vertex. The owners of the first six free vertices are therefore fixed lane patterns
+ * and the others are constant within a pass.
+ *
+ * @throws std::invalid_argument if more than max_enumeration_vertices vertices are free
+ */
+inline ExactResult enumerate(const solvers::bitsliced::Arena &arena, Objective objective, int query,
+                             const std::vector<char> &pinned) {
+    using solvers::bitsliced::Lanes;
+    const int n = arena.num_vertices;
+    std::vector<int> free;
+    for (int v = 0; v < n; ++v) {
+        if (!pinned[v]) {
+            free.push_back(v);
+        }
+    }
+    const int f = static_cast<int>(free.size());
+    if (f > max_enumeration_vertices) {
+        throw std::invalid_argument("Enumeration supports at most " + std::to_string(max_enumeration_vertices) +
+                                    " free vertices, arena has " + std::to_string(f));
+    }
+
+    constexpr int lane_bits = 6;
+    const std::uint64_t assignments = std::uint64_t(1) << f;
+    const Lanes lanes = solvers::bitsliced::first_lanes(static_cast<int>(std::min<std::uint64_t>(assignments, 64)));
+    const std::uint64_t passes = f > lane_bits ? assignments >> lane_bits : 1;
+
+    solvers::bitsliced::SlicedSet player1(n, 0);
+    for (int i = 0; i < f && i < lane_bits; ++i) {
+        for (int lane = 0; lane < solvers::bitsliced::lane_count; ++lane) {
+            if ((lane >> i) & 1) {
+                player1[free[i]] |= Lanes(1) << lane;
+            }
+        }
+    }
+
+    const auto core = ownership_independent_core(arena, objective);
+    std::uint64_t wins = 0;
+    for (std::uint64_t pass = 0; pass < passes; ++pass) {
+        for (int i = lane_bits; i < f; ++i) {
+            player1[free[i]] = ((pass >> (i - lane_bits)) & 1) ? ~Lanes(0) : 0;
+        }
+        wins += std::popcount(solve_query(arena, objective, player1, lanes, query, &core));
+    }
+
+    ExactResult result;
+    result.wins = Count(wins) << (n - f);
+    result.total = Count(1) << n;
+    result.solved = assignments;
+    result.engine = "enumeration";
+    return result;
+}
+
+/**
+ * @brief Count winning assignments by solving all 2^n of them, 64 per bitsliced pass
+ * @throws std::invalid_argument if the arena has more than max_enumeration_vertices vertices
+ */
+inline ExactResult enumerate(const solvers::bitsliced::Arena &arena, Objective objective, int query) {
+    return enumerate(arena, objective, query, std::vector<char>(arena.num_vertices, 0));
+}
+
+namespace detail {
+
+/**
+ * @brief Summary of the eliminated part of a reachability game
+ *
+ * Player 0 loses from v exactly when v lies in a trap Y avoiding the targets: every
+ * v in Y owned by player 1 has a successor in Y (or none at all), every v in Y owned by
+ * player 0 has all successors in Y. The losing region is the greatest such set, which
+ * can be computed by eliminating one vertex at a time (Bekic).
+ *
+ * For each membership pattern S of the scope vertices in Y, an entry of the signature
+ * records, for the eliminated vertices, which scope vertices have some / all of their
+ * eliminated successors in Y, and whether the query vertex is in Y. The table maps each
+ * signature to the number of owner assignments of the eliminated vertices producing it.
+ *
+ * Entry layout for k scope vertices: bits [0, k) "some successor in Y",
+ * bits [k, 2k) "all successors in Y", bit 2k "query in Y".
+ */
+struct ReachabilityFactor {
+    std::vector<int> scope;
+    std::map<std::vector<std::uint64_t>, Count> table;
+};
+
+} // namespace detail
+
+/**
+ * @brief Count winning assignments of a reachability game by dynamic programming over a tree decomposition
+ *
+ * Vertices are eliminated in the given order; eliminating x merges the summaries whose
+ * scope contains x, tries both owners of x and resolves x's membership in the losing
+ * trap as a function of its remaining neighbours. The cost is exponential only in the
+ * width of the decomposition and in the number of distinct summaries.
+ *
+ * @param arena Compressed arena (priority 1 vertices are targets)
+ * @param query Vertex whose winner is counted
+ * @param order Elimination order of every vertex, e.g. from min_fill_order
+ * @param max_width Give up if a bag has more than this many remaining neighbours (at most 20)
+ * @param max_table Give up if a summary table would exceed this many entries
+ * @param max_work Give up before a step whose merge (every combination of one signature
+ *        per child table, both owners of x, 2^k memberships each) exceeds this many entries
+ * @return Counts, or empty if a limit was hit
+ */
+inline std::optional<ExactResult> reachability_by_elimination(const solvers::bitsliced::Arena &arena, int query,
+                                                              const EliminationOrder &order, int max_width = 10,
+                                                              std::size_t max_table = std::size_t(1) << 16,
+                                                              std::size_t max_work = std::size_t(1) << 26) {
+    using detail::ReachabilityFactor;
+    const int n = arena.num_vertices;
+    if (order.width > std::min(max_width, 20) || static_cast<int>(order.order.size()) != n) {
+        return std::nullopt;
+    }
+
+    std::vector<char> eliminated(n, 0);
+    std::vector<ReachabilityFactor> factors;
+    Count query_free = 1; // Assignments of finished components with the query outside the trap
+    Count finished = 1;   // All assignments of finished components
+
+    for (size_t step = 0; step < order.order.size(); ++step) {
+        const int x = order.order[step];
+        const auto &scope = order.scopes[step];
+        const int k = static_cast<int>(scope.size());
+        auto position = [&](int v) {
+            return static_cast<int>(std::lower_bound(scope.begin(), scope.end(), v) - scope.begin());
+        };
+
+        // Summaries of earlier eliminations that mention x
+        std::vector<ReachabilityFactor> children;
+        for (auto it = factors.begin(); it != factors.end();) {
+            if (std::binary_search(it->scope.begin(), it->scope.end(), x)) {
+                children.push_back(std::move(*it));
+                it = factors.erase(it);
+            } else {
+                ++it;
+            }
+        }
+
+        // Direct edges between x and its remaining neighbours
+        std::uint64_t successors_in_scope = 0;
+        std::uint64_t predecessors_in_scope = 0;
+        bool self_loop = false;
+        const int out_degree = arena.successor_offsets[x + 1] - arena.successor_offsets[x];
+        for (int s = arena.successor_offsets[x]; s < arena.successor_offsets[x + 1]; ++s) {
+            const int w = arena.successors[s];
+            if (w == x) {
+                self_loop = true;
+            } else if (!eliminated[w]) {
+                successors_in_scope |= std::uint64_t(1) << position(w);
+            }
+        }
+        for (int p = arena.predecessor_offsets[x]; p < arena.predecessor_offsets[x + 1]; ++p) {
+            const int w = arena.predecessors[p];
+            if (w != x && !eliminated[w]) {
+                predecessors_in_scope |= std::uint64_t(1) << position(w);
+            }
+        }
+        const bool target = arena.priority[x] == 1;
+
+        // The merge below is an odometer over the child tables; bound it before starting
+        std::size_t work = std::size_t(2) << k;
+        for (const auto &child : children) {
+            if (work > max_work / child.table.size()) {
+                return std::nullopt;
+            }
+            work *= child.table.size();
+        }
+        if (work > max_work) {
+            return std::nullopt;
+        }
+
+        // Where the scope vertices of every child sit in x's scope (-1 for x itself)
+        std::vector<std::vector<int>> child_positions(children.size());
+        for (size_t c = 0; c < children.size(); ++c) {
+            for (const int v : children[c].scope) {
+                child_positions[c].push_back(v == x ? -1 : position(v));
+            }
+        }
+
+        ReachabilityFactor factor;
+        factor.scope = scope;
+        const std::uint64_t all_scope = k == 64 ? ~std::uint64_t(0) : (std::uint64_t(1) << k) - 1;
+        std::vector<const std::vector<std::uint64_t> *> chosen(children.size());
+        std::vector<Count> chosen_count(children.size());
+
+        // Enumerate one signature per child; odometer over the child tables
+        std::vector<decltype(children[0].table.begin())> cursor;
+        for (auto &child : children) {
+            cursor.push_back(child.table.begin());
+        }
+        while (true) {
+            Count combined = 1;
+            for (size_t c = 0; c < children.size(); ++c) {
+                chosen[c] = &cursor[c]->first;
+                combined *= cursor[c]->second;
+            }
+
+            for (int owner = 0; owner < 2; ++owner) {
+                std::vector<std::uint64_t> signature(std::size_t(1) << k);
+                for (std::uint64_t members = 0; members < signature.size(); ++members) {
+                    // Children's view for a given membership of x
+                    auto merge = [&](bool x_member, std::uint64_t &some, std::uint64_t &all, bool &query_member,
+                                     bool &x_some, bool &x_all) {
+                        some = 0;
+                        all = all_scope;
+                        query_member = false;
+                        x_some = false;
+                        x_all = true;
+                        for (size_t c = 0; c < children.size(); ++c) {
+                            const auto &positions = child_positions[c];
+                            const int child_k = static_cast<int>(positions.size());
+                            std::uint64_t index = 0;
+                            for (int j = 0; j < child_k; ++j) {
+                                const bool member = positions[j] < 0 ? x_member : ((members >> positions[j]) & 1);
+                                index |= std::uint64_t(member) << j;
+                            }
+                            const std::uint64_t entry = (*chosen[c])[index];
+                            for (int j = 0; j < child_k; ++j) {
+                                const bool child_some = (entry >> j) & 1;
+                                const bool child_all = (entry >> (child_k + j)) & 1;
+                                if (positions[j] < 0) {
+                                    x_some = x_some || child_some;
+                                    x_all = x_all && child_all;
+                                } else {
+                                    some |= std::uint64_t(child_some) << positions[j];
+                                    if (!child_all) {
+                                        all &= ~(std::uint64_t(1) << positions[j]);
+                                    }
+                                }
+                            }
+                            query_member = query_member || ((entry >> (2 * child_k)) & 1);
+                        }
+                    };
+
+                    std::uint64_t some = 0;
+                    std::uint64_t all = 0;
+                    bool query_member = false;
+                    bool x_some = false;
+                    bool x_all = true;
+
+                    // Greatest fixpoint in x: keep x in the trap if that is consistent
+                    bool x_member = false;
+                    if (!target) {
+                        merge(true, some, all, query_member, x_some, x_all);
+                        const bool some_successor = x_some || (successors_in_scope & members) || self_loop;
+                        const bool all_successors = x_all && (successors_in_scope & ~members) == 0;
+                        x_member = owner == 1 ? (some_successor || out_degree == 0) : all_successors;
+                    }
+                    if (!x_member) {
+                        merge(false, some, all, query_member, x_some, x_all);
+                    }
+
+                    if (x_member) {
+                        some |= predecessors_in_scope;
+                    } else {
+                        all &= ~predecessors_in_scope;
+                    }
+                    query_member = query_member || (x == query && x_member);
+                    signature[members] = some | (all << k) | (std::uint64_t(query_member) << (2 * k));
+                }
+                factor.table[signature] += combined;
+                if (factor.table.size() > max_table) {
+                    return std::nullopt;
+                }
+            }
+
+            // Advance the odometer
+            size_t c = 0;
+            for (; c < children.size(); ++c) {
+                if (++cursor[c] != children[c].table.end()) {
+                    break;
+                }
+                cursor[c] = children[c].table.begin();
+            }
+            if (c == children.size()) {
+                break;
+            }
+        }
+
+        eliminated[x] = 1;
+        if (k == 0) {
+            // A finished connected component: only the query flag is left
+            Count free = 0;
+            Count component = 0;
+            for (const auto &[signature, count] : factor.table) {
+                component += count;
+                if (!(signature[0] & 1)) {
+                    free += count;
+                }
+            }
+            query_free *= free;
+            finished *= component;
+        } else {
+            factors.push_back(std::move(factor));
+        }
+    }
+
+    ExactResult result;
+    result.wins = query_free;
+    result.total = finished;
+    result.engine = "tree-decomposition";
+    result.width = order.width;
+    return result;
+}
+
+} // namespace ownership
+} // namespace ggg
@@ -0,0 +1,81 @@
+#pragma once
+
+#include "libggg/ownership/objective.hpp"
+#include "libggg/solvers/bitsliced.hpp"
+#include <vector>
+
+namespace ggg {
+namespace ownership {
+
+/**
+ * @brief Vertices whose owner never changes any winner
+ *
+ * A vertex is ownership-irrelevant if it has exactly one successor, or if all of its
+ * successors are won by the same player under every ownership: whoever owns it, its own
+ * winner is fixed and every play through it continues in that player's winning region.
+ * Such bits can be dropped from sampling and enumeration, multiplying exact counts by 2
+ * per dropped bit.
+ */
+struct IrrelevantVertices {
+    std::vector<char> irrelevant; ///< Non-zero for ownership-irrelevant vertices
+    int count = 0;                ///< Number of ownership-irrelevant vertices
+};
+
+/**
+ * @brief Detect ownership-irrelevant vertices
+ *
+ * The regions won under every ownership come from the two extreme assignments, solved as
+ * two lanes of one bitsliced pass: player 0 wins everywhere it wins while owning nothing,
+ * and loses everywhere it loses while owning everything. This monotonicity argument needs
+ * every vertex to have a successor for Buchi and parity objectives, so for arenas with
+ * dead ends only the single-successor test is applied there.
+ *
+ * @param arena Compressed arena
+ * @param objective Winning condition
+ * @return Flags and count of ownership-irrelevant vertices
+ */
+inline IrrelevantVertices irrelevant_vertices(const solvers::bitsliced::Arena &arena, Objective objective) {
+    using solvers::bitsliced::Lanes;
+    const int n = arena.num_vertices;
+
+    bool monotone = true;
+    if (objective != Objective::Reachability) {
+        for (int v = 0; v < n; ++v) {
+            if (arena.successor_offsets[v] == arena.successor_offsets[v + 1]) {
+                monotone = false;
+            }
+        }
+    }
+
+    // Lane 0: player 0 owns every vertex, lane 1: player 1 owns every vertex
+    solvers::bitsliced::SlicedSet won;
+    if (monotone) {
+        won = solve_lanes(arena, objective, solvers::bitsliced::SlicedSet(n, 0b10), solvers::bitsliced::first_lanes(2));
+    }
+
+    IrrelevantVertices result;
+    result.irrelevant.assign(n, 0);
+    for (int v = 0; v < n; ++v) {
+        const int begin = arena.successor_offsets[v];
+        const int end = arena.successor_offsets[v + 1];
+        bool irrelevant = end - begin == 1;
+        if (!irrelevant && monotone && end > begin) {
+            bool always_won = true;
+            bool always_lost = true;
+            for (int s = begin; s < end; ++s) {
+                const Lanes lanes = won[arena.successors[s]];
+                always_won = always_won && ((lanes >> 1) & 1);
+                always_lost = always_lost && !(lanes & 1);
+            }
+            irrelevant = always_won || always_lost;
+        }
+        if (irrelevant) {
+            result.irrelevant[v] = 1;
+            result.count++;
+        }
+    }
+    return result;
+}
+
+} // namespace ownership
+} // namespace ggg
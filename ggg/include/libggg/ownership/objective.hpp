@@ -0,0 +1,115 @@
+#pragma once
+
+#include "libggg/solvers/bitsliced.hpp"
+#include <optional>
+#include <string>
+
+namespace ggg {
+namespace ownership {
+
+/**
+ * @brief Winning conditions supported by the ownership analyses
+ *
+ * All of them are read from a parity graph: reachability targets and Buchi
+ * accepting vertices are the priority 1 vertices.
+ */
+enum class Objective {
+    Reachability,
+    Buchi,
+    Parity
+};
+
+/**
+ * @brief Parse an objective name (reachability, buchi, parity)
+ * @return Objective, or empty if the name is unknown
+ */
+inline std::optional<Objective> parse_objective(const std::string &name) {
+    if (name == "reachability") {
+        return Objective::Reachability;
+    }
+    if (name == "buchi") {
+        return Objective::Buchi;
+    }
+    if (name == "parity") {
+        return Objective::Parity;
+    }
+    return std::nullopt;
+}
+
+/**
+ * @brief Name of an objective as accepted by parse_objective
+ */
+inline std::string to_string(Objective objective) {
+    switch (objective) {
+    case Objective::Reachability:
+        return "reachability";
+    case Objective::Buchi:
+        return "buchi";
+    case Objective::Parity:
+        return "parity";
+    }
+    return "";
+}
+
+/**
+ * @brief Solve up to 64 ownership assignments
+ * @param arena Compressed arena
+ * @param objective Winning condition
+ * @param player1 Player 1 vertices per lane
+ * @param lanes Lanes to solve
+ * @param core Optional reachability_core of the arena, reused by reachability solves (not with overlay priorities)
+ * @param overlay Optional edge presence and priorities per lane
+ * @return Winning region of player 0, one lane per assignment
+ */
+inline solvers::bitsliced::SlicedSet solve_lanes(const solvers::bitsliced::Arena &arena, Objective objective,
+                                                 const solvers::bitsliced::SlicedSet &player1,
+                                                 solvers::bitsliced::Lanes lanes,
+                                                 const solvers::bitsliced::SlicedSet *core = nullptr,
+                                                 const solvers::bitsliced::Overlay *overlay = nullptr) {
+    switch (objective) {
+    case Objective::Reachability:
+        if (core != nullptr && (overlay == nullptr || overlay->priority_classes.empty())) {
+            return solvers::bitsliced::solve_reachability_from(arena, player1, lanes, *core, overlay);
+        }
+        return solvers::bitsliced::solve_reachability(arena, player1, lanes, overlay);
+    case Objective::Buchi:
+        return solvers::bitsliced::solve_buchi(arena, player1, lanes, overlay);
+    case Objective::Parity:
+        break;
+    }
+    return solvers::bitsliced::solve_parity(arena, player1, lanes, nullptr, overlay);
+}
+
+/**
+ * @brief Solve up to 64 ownership assignments and report the lanes where player 0 wins a vertex
+ * @param arena Compressed arena
+ * @param objective Winning condition
+ * @param player1 Player 1 vertices per lane
+ * @param lanes Lanes to solve
+ * @param query Vertex whose winner is reported
+ * @param core Optional reachability_core of the arena, reused by reachability solves
+ * @param overlay Optional edge presence and priorities per lane
+ * @return Lanes where player 0 wins from query
+ */
+inline solvers::bitsliced::Lanes solve_query(const solvers::bitsliced::Arena &arena, Objective objective,
+                                             const solvers::bitsliced::SlicedSet &player1,
+                                             solvers::bitsliced::Lanes lanes, int query,
+                                             const solvers::bitsliced::SlicedSet *core = nullptr,
+                                             const solvers::bitsliced::Overlay *overlay = nullptr) {
+    return solve_lanes(arena, objective, player1, lanes, core, overlay)[query] & lanes;
+}
+
+/**
+ * @brief Ownership-independent state shared by every solve of one arena
+ *
+ * Currently the reachability attractor core; empty for other objectives.
+ */
+inline solvers::bitsliced::SlicedSet ownership_independent_core(const solvers::bitsliced::Arena &arena, Objective objective) {
+    if (objective == Objective::Reachability) {
+        return solvers::bitsliced::reachability_core(arena);
+    }
+    return {};
+}
+
+} // namespace ownership
+} // namespace ggg
@@ -0,0 +1,99 @@
+#pragma once
+
+#include "libggg/solvers/bitsliced.hpp"
+#include <algorithm>
+#include <bit>
+#include <cmath>
+#include <cstdint>
+#include <random>
+#include <vector>
+
+namespace ggg {
+namespace ownership {
+
+/**
+ * @brief Random arena perturbations drawn into a bitsliced overlay
+ *
+ * Besides ownership, some random-arena studies keep every edge with a probability q or
+ * jitter the priorities. Both are drawn per lane into a solvers::bitsliced::Overlay over
+ * the base arena, so a batch of 64 perturbed arenas is solved like a batch of 64
+ * ownership assignments, without building a graph per sample.
+ */
+
+/**
+ * @brief Word whose bits are independently set with the given probability
+ *
+ * Built from the binary expansion of the probability (rounded to 32 bits), from the
+ * least significant bit up: a one bit ORs a uniform word in, a zero bit ANDs one in, so
+ * each step maps the bit probability P to (b + P) / 2. A probability of 1/2 costs one
+ * word, a probability with k significant bits k words.
+ */
+inline solvers::bitsliced::Lanes bernoulli_lanes(double probability, std::mt19937_64 &rng) {
+    const auto scaled = static_cast<std::uint64_t>(std::llround(std::ldexp(std::clamp(probability, 0.0, 1.0), 32)));
+    if (scaled >> 32) {
+        return ~solvers::bitsliced::Lanes(0);
+    }
+    solvers::bitsliced::Lanes word = 0;
+    for (int b = std::countr_zero(scaled | (std::uint64_t(1) << 32)); b < 32; ++b) {
+        const solvers::bitsliced::Lanes random = rng();
+        word = ((scaled >> b) & 1) ? (word | random) : (word & random);
+    }
+    return word;
+}
+
+/**
+ * @brief Draw the present edges of 64 arenas, each edge kept with the given probability
+ *
+ * A vertex that would lose all of its edges in a lane redraws its edges in that lane, so
+ * every lane is distributed as the edge-random arena conditioned on having no new dead
+ * ends. Vertices without edges in the arena stay dead ends.
+ *
+ * @param arena Compressed arena
+ * @param probability Probability that an edge is present, in (0, 1] (at least 2^-32 is used)
+ * @param rng Random generator
+ * @param present Overlay edge presence, resized to the number of edges
+ */
+inline void draw_edges(const solvers::bitsliced::Arena &arena, double probability, std::mt19937_64 &rng,
+                       solvers::bitsliced::SlicedSet &present) {
+    using solvers::bitsliced::Lanes;
+    probability = std::max(probability, std::ldexp(1.0, -32));
+    present.assign(arena.successors.size(), 0);
+    for (int v = 0; v < arena.num_vertices; ++v) {
+        const int begin = arena.successor_offsets[v];
+        const int end = arena.successor_offsets[v + 1];
+        Lanes missing = begin < end ? ~Lanes(0) : 0;
+        while (missing) {
+            Lanes kept = 0;
+            for (int s = begin; s < end; ++s) {
+                present[s] |= bernoulli_lanes(probability, rng) & missing;
+                kept |= present[s];
+            }
+            missing = ~kept;
+        }
+    }
+}
+
+/**
+ * @brief Draw the priorities of 64 arenas, each shifted by a uniform offset in [-jitter, jitter]
+ *
+ * Offsets are independent per vertex and lane; shifted priorities are clamped at 0.
+ *
+ * @param arena Compressed arena
+ * @param jitter Largest offset
+ * @param rng Random generator
+ * @param overlay Overlay whose priority classes are overwritten in every lane
+ */
+inline void jitter_priorities(const solvers::bitsliced::Arena &arena, int jitter, std::mt19937_64 &rng,
+                              solvers::bitsliced::Overlay &overlay) {
+    std::uniform_int_distribution<int> offset(-jitter, jitter);
+    std::vector<int> priority(arena.num_vertices);
+    for (int lane = 0; lane < solvers::bitsliced::lane_count; ++lane) {
+        for (int v = 0; v < arena.num_vertices; ++v) {
+            priority[v] = std::max(0, arena.priority[v] + offset(rng));
+        }
+        solvers::bitsliced::set_priorities(overlay, priority, solvers::bitsliced::Lanes(1) << lane);
+    }
+}
+
+} // namespace ownership
+} // namespace ggg
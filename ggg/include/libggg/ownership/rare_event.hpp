@@ -0,0 +1,255 @@
+#pragma once
+
+#include "libggg/ownership/objective.hpp"
+#include "libggg/solvers/bitsliced.hpp"
+#include <algorithm>
+#include <bit>
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <random>
+#include <vector>
+
+namespace ggg {
+namespace ownership {
+
+/**
+ * @brief Parameters of the cross-entropy rare-event estimator
+ */
+struct CrossEntropyOptions {
+    long level_samples = 10000; ///< Samples drawn per cross-entropy level
+    long final_samples = 100000; ///< Importance samples of the final estimate
+    double rarity = 0.1;        ///< Fraction of the samples kept as elite per level
+    double smoothing = 0.7;     ///< Weight of the new biases when updating
+    int max_levels = 40;        ///< Levels tried before estimating with the current biases
+};
+
+/**
+ * @brief Outcome of a rare-event estimate
+ */
+struct RareEventResult {
+    double estimate = 0.0;       ///< Estimated probability that player 0 wins the query vertex
+    double standard_error = 0.0; ///< Standard error of the estimate, from the weighted sample variance (0 without hits)
+    double relative_error = 0.0; ///< Standard error divided by the estimate (infinite without hits)
+    long solves = 0;             ///< Assignments solved, levels included
+    long hits = 0;               ///< Final samples where player 0 won
+    int levels = 0;              ///< Cross-entropy levels run
+    bool reached = false;        ///< Whether the levels reached the winning event
+    std::vector<double> bias;    ///< Final probability that each vertex is owned by player 1
+};
+
+namespace detail {
+
+/**
+ * @brief Number of steps of the owner probabilities: biases are multiples of 1/256
+ */
+inline constexpr int bias_steps = 256;
+
+/**
+ * @brief 64 independent bits that are set with probability steps / 256 each
+ *
+ * Reads the bits of steps from the least significant one: a set bit ORs in a fresh
+ * random word, a clear one ANDs it in, which maps probability p to (1 + p) / 2 or p / 2.
+ */
+template <typename Generator>
+solvers::bitsliced::Lanes bernoulli_lanes(int steps, Generator &rng) {
+    solvers::bitsliced::Lanes word = 0;
+    for (int bit = 0; bit < 8; ++bit) {
+        const solvers::bitsliced::Lanes random = rng();
+        word = (steps >> bit) & 1 ? (word | random) : (word & random);
+    }
+    return word;
+}
+
+} // namespace detail
+
+/**
+ * @brief Estimate a small winning probability by cross-entropy importance sampling
+ *
+ * Owners are drawn with per-vertex biases instead of fairly, and every sample is
+ * weighted by its likelihood ratio against the uniform distribution, so the weighted
+ * win frequency stays unbiased. The biases are tuned by multilevel cross-entropy on a
+ * score: the number of vertices reachable from the query that player 0 wins, with the
+ * winning event above every other score. Each level keeps the top rarity fraction of
+ * its samples and moves the biases towards their likelihood-weighted owner frequencies,
+ * until the elite threshold reaches the winning event. Biases are multiples of 1/256 in
+ * [1/256, 255/256] so that 64 lanes are drawn with eight random words per vertex.
+ *
+ * @param arena Compressed arena
+ * @param objective Winning condition
+ * @param query Query vertex
+ * @param pinned Vertices always owned by player 0 (may be empty)
+ * @param options Estimator parameters
+ * @param seed Random seed
+ * @return Estimate with its relative error and the number of solves
+ */
+inline RareEventResult cross_entropy_estimate(const solvers::bitsliced::Arena &arena, Objective objective, int query,
+                                              const std::vector<char> &pinned, const CrossEntropyOptions &options,
+                                              std::uint64_t seed) {
+    namespace bitsliced = solvers::bitsliced;
+    const int n = arena.num_vertices;
+    std::mt19937_64 rng(seed);
+    const auto core = ownership_independent_core(arena, objective);
+    const auto *core_pointer = core.empty() ? nullptr : &core;
+    const auto is_pinned = [&](int v) { return !pinned.empty() && pinned[v]; };
+
+    // Vertices reachable from the query make up the score
+    std::vector<char> reachable(n, 0);
+    std::vector<int> stack{query};
+    reachable[query] = 1;
+    while (!stack.empty()) {
+        const int v = stack.back();
+        stack.pop_back();
+        for (int s = arena.successor_offsets[v]; s < arena.successor_offsets[v + 1]; ++s) {
+            const int w = arena.successors[s];
+            if (!reachable[w]) {
+                reachable[w] = 1;
+                stack.push_back(w);
+            }
+        }
+    }
+    const long winning_score = std::count(reachable.begin(), reachable.end(), 1) + 1;
+
+    RareEventResult result;
+    std::vector<int> steps(n, detail::bias_steps / 2);
+    std::vector<double> bias(n, 0.5);
+
+    // Draw count samples with the current biases; per sample: score, log likelihood ratio, owners
+    std::vector<long> scores;
+    std::vector<double> log_weights;
+    std::vector<char> wins;
+    std::vector<bitsliced::SlicedSet> batches;
+    const auto draw = [&](long count, bool keep_owners) {
+        scores.assign(count, 0);
+        log_weights.assign(count, 0.0);
+        wins.assign(count, 0);
+        batches.clear();
+
+        // log(1/2 / q) if owned by player 1, log(1/2 / (1 - q)) otherwise
+        std::vector<double> log_player1(n, 0.0);
+        std::vector<double> log_player0(n, 0.0);
+        double log_all_player0 = 0.0;
+        for (int v = 0; v < n; ++v) {
+            if (is_pinned(v)) {
+                continue;
+            }
+            const double q = static_cast<double>(steps[v]) / detail::bias_steps;
+            log_player1[v] = std::log(0.5 / q);
+            log_player0[v] = std::log(0.5 / (1.0 - q));
+            log_all_player0 += log_player0[v];
+        }
+
+        bitsliced::SlicedSet player1(n);
+        for (long first = 0; first < count; first += bitsliced::lane_count) {
+            const int batch = static_cast<int>(std::min<long>(bitsliced::lane_count, count - first));
+            const auto lanes = bitsliced::first_lanes(batch);
+            for (int v = 0; v < n; ++v) {
+                player1[v] = is_pinned(v) ? 0 : detail::bernoulli_lanes(steps[v], rng) & lanes;
+            }
+            const auto region = solve_lanes(arena, objective, player1, lanes, core_pointer);
+            result.solves += batch;
+
+            for (int lane = 0; lane < batch; ++lane) {
+                log_weights[first + lane] = log_all_player0;
+            }
+            for (int v = 0; v < n; ++v) {
+                for (auto word = player1[v]; word != 0; word &= word - 1) {
+                    log_weights[first + std::countr_zero(word)] += log_player1[v] - log_player0[v];
+                }
+                if (reachable[v]) {
+                    for (auto word = region[v] & lanes; word != 0; word &= word - 1) {
+                        scores[first + std::countr_zero(word)]++;
+                    }
+                }
+            }
+            for (auto word = region[query] & lanes; word != 0; word &= word - 1) {
+                const int lane = std::countr_zero(word);
+                scores[first + lane] = winning_score;
+                wins[first + lane] = 1;
+            }
+            if (keep_owners) {
+                batches.push_back(player1);
+            }
+        }
+    };
+
+    for (int level = 0; level < options.max_levels && !result.reached; ++level) {
+        const long count = options.level_samples;
+        draw(count, true);
+        result.levels++;
+
+        std::vector<long> sorted = scores;
+        const long rank = std::clamp<long>(static_cast<long>(std::ceil((1.0 - options.rarity) * count)), 0, count - 1);
+        std::nth_element(sorted.begin(), sorted.begin() + rank, sorted.end());
+        long threshold = sorted[rank];
+        if (threshold >= winning_score) {
+            threshold = winning_score;
+            result.reached = true;
+        }
+
+        // Likelihood-weighted player 1 frequency among the elite samples
+        double top = -std::numeric_limits<double>::infinity();
+        for (long i = 0; i < count; ++i) {
+            if (scores[i] >= threshold) {
+                top = std::max(top, log_weights[i]);
+            }
+        }
+        std::vector<double> owned(n, 0.0);
+        double total = 0.0;
+        for (long i = 0; i < count; ++i) {
+            if (scores[i] < threshold) {
+                continue;
+            }
+            const double weight = std::exp(log_weights[i] - top);
+            total += weight;
+            const auto &player1 = batches[i / bitsliced::lane_count];
+            const int lane = static_cast<int>(i % bitsliced::lane_count);
+            for (int v = 0; v < n; ++v) {
+                if ((player1[v] >> lane) & 1) {
+                    owned[v] += weight;
+                }
+            }
+        }
+        if (total <= 0.0) {
+            continue;
+        }
+        for (int v = 0; v < n; ++v) {
+            if (is_pinned(v)) {
+                continue;
+            }
+            bias[v] = options.smoothing * owned[v] / total + (1.0 - options.smoothing) * bias[v];
+            steps[v] = std::clamp(static_cast<int>(std::lround(bias[v] * detail::bias_steps)), 1, detail::bias_steps - 1);
+            bias[v] = static_cast<double>(steps[v]) / detail::bias_steps;
+        }
+    }
+
+    // Final importance-sampling estimate with the tuned biases
+    const long count = std::max(options.final_samples, 2L);
+    draw(count, false);
+    double sum = 0.0;
+    double sum_squares = 0.0;
+    for (long i = 0; i < count; ++i) {
+        if (wins[i]) {
+            const double weight = std::exp(log_weights[i]);
+            sum += weight;
+            sum_squares += weight * weight;
+            result.hits++;
+        }
+    }
+    result.estimate = sum / static_cast<double>(count);
+    const double variance =
+        std::max(0.0, sum_squares / static_cast<double>(count) - result.estimate * result.estimate) / static_cast<double>(count - 1);
+    result.standard_error = std::sqrt(variance);
+    result.relative_error =
+        result.estimate > 0.0 ? result.standard_error / result.estimate : std::numeric_limits<double>::infinity();
+    for (int v = 0; v < n; ++v) {
+        if (is_pinned(v)) {
+            bias[v] = 0.0;
+        }
+    }
+    result.bias = std::move(bias);
+    return result;
+}
+
+} // namespace ownership
+} // namespace ggg
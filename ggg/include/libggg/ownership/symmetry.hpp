@@ -0,0 +1,407 @@
+#pragma once
+
+#include "libggg/ownership/exact.hpp"
+#include "libggg/ownership/objective.hpp"
+#include "libggg/solvers/bitsliced.hpp"
+#include <algorithm>
+#include <cstdint>
+#include <map>
+#include <optional>
+#include <vector>
+
+namespace ggg {
+namespace ownership {
+
+/**
+ * @brief Vertex permutation, perm[v] is the image of v
+ */
+using Permutation = std::vector<int>;
+
+/**
+ * @brief Automorphisms of an arena that preserve priorities and fix the query vertex
+ *
+ * Permuting the owners of an assignment by such an automorphism yields an isomorphic
+ * game with the same winner at the query vertex, so exact counts only need one
+ * assignment per orbit.
+ */
+struct SymmetryGroup {
+    std::vector<Permutation> generators; ///< Generators of the group
+    std::vector<int> moved;              ///< Vertices moved by some generator, ascending
+    Count order = 1;                     ///< Number of automorphisms
+};
+
+namespace detail {
+
+/**
+ * @brief Sorted successor lists, used to test edges by binary search
+ */
+inline std::vector<std::vector<int>> sorted_successors(const solvers::bitsliced::Arena &arena) {
+    std::vector<std::vector<int>> successors(arena.num_vertices);
+    for (int v = 0; v < arena.num_vertices; ++v) {
+        successors[v].assign(arena.successors.begin() + arena.successor_offsets[v],
+                             arena.successors.begin() + arena.successor_offsets[v + 1]);
+        std::sort(successors[v].begin(), successors[v].end());
+    }
+    return successors;
+}
+
+/**
+ * @brief Refine a vertex colouring until it is equitable
+ *
+ * Every round recolours a vertex by its colour together with the multisets of
+ * successor and predecessor colours. New colours are the ranks of these signatures, so
+ * the result only depends on the colouring up to isomorphism and two colourings can be
+ * refined side by side.
+ */
+inline std::vector<int> refine(const solvers::bitsliced::Arena &arena, std::vector<int> colors) {
+    const int n = arena.num_vertices;
+    int num_colors = -1;
+    std::vector<std::vector<int>> signatures(n);
+    while (true) {
+        for (int v = 0; v < n; ++v) {
+            auto &signature = signatures[v];
+            signature.clear();
+            for (int s = arena.successor_offsets[v]; s < arena.successor_offsets[v + 1]; ++s) {
+                signature.push_back(colors[arena.successors[s]]);
+            }
+            std::sort(signature.begin(), signature.end());
+            signature.push_back(-1);
+            const size_t split = signature.size();
+            for (int p = arena.predecessor_offsets[v]; p < arena.predecessor_offsets[v + 1]; ++p) {
+                signature.push_back(colors[arena.predecessors[p]]);
+            }
+            std::sort(signature.begin() + split, signature.end());
+            signature.insert(signature.begin(), colors[v]);
+        }
+
+        std::map<std::vector<int>, int> ranks;
+        for (const auto &signature : signatures) {
+            ranks.emplace(signature, 0);
+        }
+        int rank = 0;
+        for (auto &entry : ranks) {
+            entry.second = rank++;
+        }
+        for (int v = 0; v < n; ++v) {
+            colors[v] = ranks[signatures[v]];
+        }
+        if (rank == num_colors) {
+            return colors;
+        }
+        num_colors = rank;
+    }
+}
+
+/**
+ * @brief Give v a colour of its own and refine
+ */
+inline std::vector<int> individualize(const solvers::bitsliced::Arena &arena, std::vector<int> colors, int v) {
+    colors[v] = arena.num_vertices;
+    return refine(arena, std::move(colors));
+}
+
+/**
+ * @brief Check that a permutation maps every edge to an edge
+ */
+inline bool is_automorphism(const std::vector<std::vector<int>> &successors, const Permutation &perm) {
+    for (size_t v = 0; v < successors.size(); ++v) {
+        const auto &image = successors[perm[v]];
+        if (image.size() != successors[v].size()) {
+            return false;
+        }
+        for (const int w : successors[v]) {
+            if (!std::binary_search(image.begin(), image.end(), perm[w])) {
+                return false;
+            }
+        }
+    }
+    return true;
+}
+
+/**
+ * @brief Search for an automorphism mapping colouring a onto colouring b
+ *
+ * Individualises a vertex of the first non-singleton cell of a against every vertex of
+ * the same cell of b until both colourings are discrete.
+ */
+inline std::optional<Permutation> find_automorphism(const solvers::bitsliced::Arena &arena,
+                                                    const std::vector<std::vector<int>> &successors,
+                                                    const std::vector<int> &a, const std::vector<int> &b) {
+    const int n = arena.num_vertices;
+    std::vector<int> sizes_a(n + 1, 0);
+    std::vector<int> sizes_b(n + 1, 0);
+    for (int v = 0; v < n; ++v) {
+        sizes_a[a[v]]++;
+        sizes_b[b[v]]++;
+    }
+    if (sizes_a != sizes_b) {
+        return std::nullopt;
+    }
+
+    const auto cell = std::find_if(sizes_a.begin(), sizes_a.end(), [](int size) { return size > 1; });
+    if (cell == sizes_a.end()) {
+        Permutation perm(n);
+        std::vector<int> vertex_of_b(n);
+        for (int w = 0; w < n; ++w) {
+            vertex_of_b[b[w]] = w;
+        }
+        for (int v = 0; v < n; ++v) {
+            perm[v] = vertex_of_b[a[v]];
+        }
+        if (is_automorphism(successors, perm)) {
+            return perm;
+        }
+        return std::nullopt;
+    }
+
+    const int color = static_cast<int>(cell - sizes_a.begin());
+    const int v = static_cast<int>(std::find(a.begin(), a.end(), color) - a.begin());
+    const auto individualized = individualize(arena, a, v);
+    for (int w = 0; w < n; ++w) {
+        if (b[w] == color) {
+            if (auto perm = find_automorphism(arena, successors, individualized, individualize(arena, b, w))) {
+                return perm;
+            }
+        }
+    }
+    return std::nullopt;
+}
+
+/**
+ * @brief Orbit of a vertex under a set of permutations
+ */
+inline std::vector<int> orbit(int v, const std::vector<Permutation> &generators, int n) {
+    std::vector<char> seen(n, 0);
+    std::vector<int> members{v};
+    seen[v] = 1;
+    for (size_t i = 0; i < members.size(); ++i) {
+        for (const auto &generator : generators) {
+            const int w = generator[members[i]];
+            if (!seen[w]) {
+                seen[w] = 1;
+                members.push_back(w);
+            }
+        }
+    }
+    return members;
+}
+
+} // namespace detail
+
+/**
+ * @brief Compute generators of the automorphism group fixing one vertex
+ *
+ * Individualisation-refinement along a base b1, b2, ...: at level i the colouring has
+ * b1..b(i-1) individualised, and for every vertex c of b_i's cell not yet in the orbit
+ * of b_i an automorphism mapping b_i to c is searched for. The automorphisms found at
+ * all levels generate the group, and its order is the product of the basic orbit sizes.
+ *
+ * @param arena Compressed arena
+ * @param fixed_vertex Vertex every automorphism must fix (the query)
+ * @return Generators, moved vertices and group order
+ */
+inline SymmetryGroup automorphism_group(const solvers::bitsliced::Arena &arena, int fixed_vertex) {
+    const int n = arena.num_vertices;
+    const auto successors = detail::sorted_successors(arena);
+
+    std::vector<int> colors(n);
+    std::vector<int> priorities = arena.priority;
+    std::sort(priorities.begin(), priorities.end());
+    for (int v = 0; v < n; ++v) {
+        colors[v] = static_cast<int>(std::lower_bound(priorities.begin(), priorities.end(), arena.priority[v]) -
+                                     priorities.begin());
+    }
+    colors = detail::individualize(arena, colors, fixed_vertex);
+
+    SymmetryGroup group;
+    std::vector<int> base;
+    std::vector<size_t> level_start;
+    while (true) {
+        std::vector<int> sizes(n + 1, 0);
+        for (int v = 0; v < n; ++v) {
+            sizes[colors[v]]++;
+        }
+        const auto cell = std::find_if(sizes.begin(), sizes.end(), [](int size) { return size > 1; });
+        if (cell == sizes.end()) {
+            break;
+        }
+        const int color = static_cast<int>(cell - sizes.begin());
+        const int b = static_cast<int>(std::find(colors.begin(), colors.end(), color) - colors.begin());
+
+        const auto individualized = detail::individualize(arena, colors, b);
+        std::vector<Permutation> level;
+        for (int c = b + 1; c < n; ++c) {
+            if (colors[c] != color) {
+                continue;
+            }
+            const auto reached = detail::orbit(b, level, n);
+            if (std::find(reached.begin(), reached.end(), c) != reached.end()) {
+                continue;
+            }
+            if (auto perm = detail::find_automorphism(arena, successors, individualized,
+                                                      detail::individualize(arena, colors, c))) {
+                level.push_back(std::move(*perm));
+            }
+        }
+
+        base.push_back(b);
+        level_start.push_back(group.generators.size());
+        group.generators.insert(group.generators.end(), level.begin(), level.end());
+        colors = individualized;
+    }
+
+    // Generators from level i on generate the stabiliser of b1..b(i-1)
+    for (size_t i = 0; i < base.size(); ++i) {
+        const std::vector<Permutation> stabilizer(group.generators.begin() + level_start[i], group.generators.end());
+        group.order *= static_cast<unsigned>(detail::orbit(base[i], stabilizer, n).size());
+    }
+    for (int v = 0; v < n; ++v) {
+        for (const auto &generator : group.generators) {
+            if (generator[v] != v) {
+                group.moved.push_back(v);
+                break;
+            }
+        }
+    }
+    return group;
+}
+
+/**
+ * @brief Largest number of moved vertices whose ownership patterns are split into orbits
+ */
+inline constexpr int max_symmetric_vertices = 24;
+
+/**
+ * @brief Count winning assignments solving one assignment per orbit of the automorphism group
+ *
+ * The automorphisms only permute the moved vertices, so the owners of the moved vertices
+ * are split into orbits once (the smallest pattern of an orbit represents it, weighted by
+ * the orbit size, which sums to 2^m by the orbit-counting lemma) and every representative
+ * is combined with all owners of the fixed vertices. If too many vertices are moved,
+ * generators are dropped; any subgroup still gives exact counts.
+ *
+ * Pinned vertices are left with player 0 and counted twice each, as in enumerate. The
+ * pinned set must be invariant under the group, which holds for irrelevant_vertices.
+ *
+ * @throws std::invalid_argument if more than max_enumeration_vertices vertices are free
+ */
+inline ExactResult enumerate_symmetric(const solvers::bitsliced::Arena &arena, Objective objective, int query,
+                                       SymmetryGroup group, const std::vector<char> &pinned) {
+    using solvers::bitsliced::Lanes;
+    const int n = arena.num_vertices;
+    const int num_pinned = static_cast<int>(std::count_if(pinned.begin(), pinned.end(), [](char p) { return p; }));
+    if (n - num_pinned > max_enumeration_vertices) {
+        throw std::invalid_argument("Enumeration supports at most " + std::to_string(max_enumeration_vertices) +
+                                    " free vertices, arena has " + std::to_string(n - num_pinned));
+    }
+
+    auto moved_by = [n, &pinned](const std::vector<Permutation> &generators) {
+        std::vector<int> moved;
+        for (int v = 0; v < n; ++v) {
+            if (!pinned[v] && std::any_of(generators.begin(), generators.end(), [v](const Permutation &g) { return g[v] != v; })) {
+                moved.push_back(v);
+            }
+        }
+        return moved;
+    };
+    group.moved = moved_by(group.generators);
+    while (static_cast<int>(group.moved.size()) > max_symmetric_vertices) {
+        group.generators.pop_back();
+        group.moved = moved_by(group.generators);
+    }
+
+    const auto &moved = group.moved;
+    const int m = static_cast<int>(moved.size());
+    std::vector<int> fixed;
+    std::vector<int> index_of(n, -1);
+    for (int i = 0; i < m; ++i) {
+        index_of[moved[i]] = i;
+    }
+    for (int v = 0; v < n; ++v) {
+        if (index_of[v] < 0 && !pinned[v]) {
+            fixed.push_back(v);
+        }
+    }
+
+    // Generators acting on bit positions of the moved-vertex patterns
+    std::vector<std::vector<int>> actions;
+    for (const auto &generator : group.generators) {
+        std::vector<int> action(m);
+        for (int i = 0; i < m; ++i) {
+            action[i] = index_of[generator[moved[i]]];
+        }
+        actions.push_back(std::move(action));
+    }
+
+    std::vector<std::uint32_t> representatives;
+    std::vector<std::uint64_t> weights;
+    std::vector<bool> seen(std::size_t(1) << m, false);
+    std::vector<std::uint32_t> members;
+    for (std::uint32_t pattern = 0; pattern < (std::uint32_t(1) << m); ++pattern) {
+        if (seen[pattern]) {
+            continue;
+        }
+        members.assign(1, pattern);
+        seen[pattern] = true;
+        for (size_t i = 0; i < members.size(); ++i) {
+            for (const auto &action : actions) {
+                std::uint32_t image = 0;
+                for (int j = 0; j < m; ++j) {
+                    image |= ((members[i] >> j) & 1) << action[j];
+                }
+                if (!seen[image]) {
+                    seen[image] = true;
+                    members.push_back(image);
+                }
+            }
+        }
+        representatives.push_back(pattern);
+        weights.push_back(members.size());
+    }
+
+    // Lane l solves representative r with fixed-vertex owners f, flattened as r + R f
+    const std::uint64_t num_representatives = representatives.size();
+    const std::uint64_t assignments = num_representatives << fixed.size();
+    solvers::bitsliced::SlicedSet player1(n);
+    const auto core = ownership_independent_core(arena, objective);
+    std::uint64_t wins = 0;
+    for (std::uint64_t first = 0; first < assignments; first += solvers::bitsliced::lane_count) {
+        const int batch = static_cast<int>(std::min<std::uint64_t>(solvers::bitsliced::lane_count, assignments - first));
+        std::fill(player1.begin(), player1.end(), 0);
+        for (int lane = 0; lane < batch; ++lane) {
+            const std::uint64_t r = (first + lane) % num_representatives;
+            const std::uint64_t f = (first + lane) / num_representatives;
+            for (int i = 0; i < m; ++i) {
+                player1[moved[i]] |= Lanes((representatives[r] >> i) & 1) << lane;
+            }
+            for (size_t j = 0; j < fixed.size(); ++j) {
+                player1[fixed[j]] |= Lanes((f >> j) & 1) << lane;
+            }
+        }
+        Lanes won = solve_query(arena, objective, player1, solvers::bitsliced::first_lanes(batch), query, &core);
+        while (won) {
+            const int lane = std::countr_zero(won);
+            won &= won - 1;
+            wins += weights[(first + lane) % num_representatives];
+        }
+    }
+
+    ExactResult result;
+    result.wins = Count(wins) << num_pinned;
+    result.total = Count(1) << n;
+    result.solved = assignments;
+    result.engine = "symmetry-reduced enumeration";
+    return result;
+}
+
+/**
+ * @brief Count winning assignments solving one assignment per orbit of the automorphism group
+ * @throws std::invalid_argument if the arena has more than max_enumeration_vertices vertices
+ */
+inline ExactResult enumerate_symmetric(const solvers::bitsliced::Arena &arena, Objective objective, int query,
+                                       const SymmetryGroup &group) {
+    return enumerate_symmetric(arena, objective, query, group, std::vector<char>(arena.num_vertices, 0));
+}
+
+} // namespace ownership
+} // namespace ggg
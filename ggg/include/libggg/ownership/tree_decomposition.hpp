@@ -0,0 +1,150 @@
+#pragma once
+
+#include "libggg/solvers/bitsliced.hpp"
+#include <algorithm>
+#include <limits>
+#include <set>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+namespace ggg {
+namespace ownership {
+
+/**
+ * @brief Vertex elimination order of the underlying undirected graph
+ *
+ * Eliminating the vertices in this order and taking every vertex together with its
+ * remaining neighbours as a bag yields a tree decomposition; its width is the
+ * largest number of remaining neighbours met.
+ */
+struct EliminationOrder {
+    std::vector<int> order;               ///< Vertices in elimination order
+    std::vector<std::vector<int>> scopes; ///< scopes[i]: sorted remaining neighbours of order[i] when eliminated
+    int width = 0;                        ///< Width of the induced tree decomposition
+};
+
+/**
+ * @brief Compute an elimination order with the min-fill heuristic
+ *
+ * Repeatedly eliminates the vertex whose neighbours need the fewest fill edges to
+ * become a clique (ties broken by degree, then index), adding those fill edges.
+ * Edge directions and self-loops are ignored. Neighbourhoods are kept as ordered
+ * sets and fill counts are updated only where an elimination changes them.
+ *
+ * @param arena Compressed arena
+ * @param max_width Stop before eliminating a vertex with more remaining neighbours
+ * @return Elimination order with its bags and width; if it stopped early, the order
+ *         is incomplete and the width is the size of the bag that stopped it
+ */
+inline EliminationOrder min_fill_order(const solvers::bitsliced::Arena &arena,
+                                       int max_width = std::numeric_limits<int>::max()) {
+    const int n = arena.num_vertices;
+    std::vector<std::set<int>> adjacent(n);
+    for (int v = 0; v < n; ++v) {
+        for (int s = arena.successor_offsets[v]; s < arena.successor_offsets[v + 1]; ++s) {
+            const int w = arena.successors[s];
+            if (w != v) {
+                adjacent[v].insert(w);
+                adjacent[w].insert(v);
+            }
+        }
+    }
+    const auto is_adjacent = [&](int v, int w) { return adjacent[v].count(w) != 0; };
+    // Visit the common neighbours of v and w, searching the longer list for the shorter one's
+    const auto for_common = [&](int v, int w, auto &&visit) {
+        if (adjacent[v].size() > adjacent[w].size()) {
+            std::swap(v, w);
+        }
+        for (const int u : adjacent[v]) {
+            if (is_adjacent(w, u)) {
+                visit(u);
+            }
+        }
+    };
+
+    // Missing edges among the neighbours of every vertex
+    std::vector<long> fill(n, 0);
+    for (int v = 0; v < n; ++v) {
+        const long degree = static_cast<long>(adjacent[v].size());
+        long inside = 0;
+        for (const int u : adjacent[v]) {
+            for_common(v, u, [&](int) { ++inside; });
+        }
+        fill[v] = degree * (degree - 1) / 2 - inside / 2;
+    }
+
+    // Remaining vertices by (fill, degree, index); a vertex leaves the set while its key changes
+    const auto key = [&](int v) { return std::make_tuple(fill[v], static_cast<int>(adjacent[v].size()), v); };
+    std::set<std::tuple<long, int, int>> candidates;
+    for (int v = 0; v < n; ++v) {
+        candidates.insert(key(v));
+    }
+    std::vector<char> touched(n, 0);
+    std::vector<int> changed;
+    const auto touch = [&](int v) {
+        if (!touched[v]) {
+            touched[v] = 1;
+            candidates.erase(key(v));
+            changed.push_back(v);
+        }
+    };
+
+    EliminationOrder result;
+    while (!candidates.empty()) {
+        const int x = std::get<2>(*candidates.begin());
+        std::vector<int> neighbours(adjacent[x].begin(), adjacent[x].end());
+        result.width = std::max(result.width, static_cast<int>(neighbours.size()));
+        if (static_cast<int>(neighbours.size()) > max_width) {
+            break;
+        }
+        candidates.erase(candidates.begin());
+
+        // x leaves its neighbours' neighbourhoods, with the edges x was missing to theirs
+        for (const int u : neighbours) {
+            touch(u);
+            long kept = 0;
+            for (const int w : neighbours) {
+                kept += w != u && is_adjacent(u, w) ? 1 : 0;
+            }
+            fill[u] -= static_cast<long>(adjacent[u].size()) - 1 - kept;
+            adjacent[u].erase(x);
+        }
+
+        // Fill edges make the neighbours a clique: common neighbours of a and b miss one edge
+        // less, and a and b each miss an edge to those of the other's neighbours they lack
+        for (size_t i = 0; i < neighbours.size(); ++i) {
+            for (size_t j = i + 1; j < neighbours.size(); ++j) {
+                const int a = neighbours[i];
+                const int b = neighbours[j];
+                if (is_adjacent(a, b)) {
+                    continue;
+                }
+                long common = 0;
+                for_common(a, b, [&](int c) {
+                    touch(c);
+                    --fill[c];
+                    ++common;
+                });
+                fill[a] += static_cast<long>(adjacent[a].size()) - common;
+                fill[b] += static_cast<long>(adjacent[b].size()) - common;
+                adjacent[a].insert(b);
+                adjacent[b].insert(a);
+            }
+        }
+
+        adjacent[x].clear();
+        for (const int v : changed) {
+            touched[v] = 0;
+            candidates.insert(key(v));
+        }
+        changed.clear();
+        result.order.push_back(x);
+        result.scopes.push_back(std::move(neighbours));
+    }
+
+    return result;
+}
+
+} // namespace ownership
+} // namespace ggg
@@ -0,0 +1,400 @@
+#pragma once
+
+#include "libggg/graphs/parity_graph.hpp"
+#include <array>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+namespace ggg {
+namespace solvers {
+namespace bitboard {
+
+/**
+ * @brief Bitboard kernels for tiny arenas (at most 64 or 128 vertices)
+ *
+ * Every vertex set is a single machine word (or a pair of words for 128 vertices),
+ * with bit i standing for the vertex with descriptor i. Successor and predecessor
+ * rows, owner sets and priority classes are precomputed masks, so one step of an
+ * attractor ("controllable predecessor") is a handful of ANDs/ORs per vertex and no
+ * memory is allocated while solving.
+ *
+ * The kernels take the player 1 vertex set as a separate argument rather than reading
+ * it from the arena, so the same arena can be solved under many ownership assignments.
+ */
+
+__extension__ typedef unsigned __int128 Mask128;
+using Mask64 = std::uint64_t;
+
+/**
+ * @brief Number of vertices representable by a mask type
+ */
+template <typename Mask>
+inline constexpr std::size_t capacity = sizeof(Mask) * 8;
+
+/**
+ * @brief Largest arena handled by the bitboard kernels
+ */
+inline constexpr std::size_t max_vertices = capacity<Mask128>;
+
+/**
+ * @brief Mask with only the given vertex set
+ */
+template <typename Mask>
+constexpr Mask bit(int vertex) {
+    return Mask(1) << vertex;
+}
+
+/**
+ * @brief Index of the lowest set bit (mask must be non-zero)
+ */
+template <typename Mask>
+inline int lowest_bit(Mask mask) {
+    if constexpr (sizeof(Mask) <= sizeof(std::uint64_t)) {
+        return std::countr_zero(static_cast<std::uint64_t>(mask));
+    } else {
+        const auto low = static_cast<std::uint64_t>(mask);
+        return low != 0 ? std::countr_zero(low) : 64 + std::countr_zero(static_cast<std::uint64_t>(mask >> 64));
+    }
+}
+
+/**
+ * @brief Number of set bits
+ */
+template <typename Mask>
+inline int count(Mask mask) {
+    if constexpr (sizeof(Mask) <= sizeof(std::uint64_t)) {
+        return std::popcount(static_cast<std::uint64_t>(mask));
+    } else {
+        return std::popcount(static_cast<std::uint64_t>(mask)) + std::popcount(static_cast<std::uint64_t>(mask >> 64));
+    }
+}
+
+/**
+ * @brief Call function(vertex) for every vertex in the mask, in increasing order
+ */
+template <typename Mask, typename Function>
+inline void for_each_vertex(Mask mask, Function &&function) {
+    while (mask) {
+        function(lowest_bit(mask));
+        mask &= mask - 1;
+    }
+}
+
+/**
+ * @brief Bitmask representation of a parity arena
+ */
+template <typename Mask>
+struct Arena {
+    int num_vertices = 0;
+    Mask vertices = 0; ///< All vertices of the arena
+    Mask player1 = 0;  ///< Vertices owned by player 1 in the source graph
+    std::array<Mask, capacity<Mask>> successors{};
+    std::array<Mask, capacity<Mask>> predecessors{};
+    std::vector<std::pair<int, Mask>> priority_classes; ///< (priority, vertices) sorted by decreasing priority
+
+    /**
+     * @brief Vertices with the given priority
+     */
+    Mask with_priority(int priority) const {
+        for (const auto &[p, mask] : priority_classes) {
+            if (p == priority) {
+                return mask;
+            }
+        }
+        return 0;
+    }
+};
+
+/**
+ * @brief Check whether a graph is small enough for the bitboard kernels
+ */
+inline bool fits(const graphs::ParityGraph &graph) {
+    return boost::num_vertices(graph) <= max_vertices;
+}
+
+/**
+ * @brief Invoke function with a value of the narrowest mask type able to hold num_vertices
+ * @return False if the arena is too large for any mask type
+ */
+template <typename Function>
+inline bool with_mask_for(std::size_t num_vertices, Function &&function) {
+    if (num_vertices <= capacity<Mask64>) {
+        function(Mask64{});
+        return true;
+    }
+    if (num_vertices <= capacity<Mask128>) {
+        function(Mask128{});
+        return true;
+    }
+    return false;
+}
+
+/**
+ * @brief Build the bitmask arena of a parity graph
+ * @throws std::invalid_argument if the graph has more vertices than the mask type holds
+ */
+template <typename Mask>
+Arena<Mask> make_arena(const graphs::ParityGraph &graph) {
+    const auto num_vertices = boost::num_vertices(graph);
+    if (num_vertices > capacity<Mask>) {
+        throw std::invalid_argument("Graph has " + std::to_string(num_vertices) +
+                                    " vertices, bitboard capacity is " + std::to_string(capacity<Mask>));
+    }
+
+    Arena<Mask> arena;
+    arena.num_vertices = static_cast<int>(num_vertices);
+
+    const auto [vertices_begin, vertices_end] = boost::vertices(graph);
+    for (const auto &vertex : boost::make_iterator_range(vertices_begin, vertices_end)) {
+        const int v = static_cast<int>(vertex);
+        arena.vertices |= bit<Mask>(v);
+        if (graph[vertex].player == 1) {
+            arena.player1 |= bit<Mask>(v);
+        }
+
+        const auto [out_begin, out_end] = boost::out_edges(vertex, graph);
+        for (const auto &edge : boost::make_iterator_range(out_begin, out_end)) {
+            const int w = static_cast<int>(boost::target(edge, graph));
+            arena.successors[v] |= bit<Mask>(w);
+            arena.predecessors[w] |= bit<Mask>(v);
+        }
+
+        const int priority = graph[vertex].priority;
+        auto it = arena.priority_classes.begin();
+        while (it != arena.priority_classes.end() && it->first > priority) {
+            ++it;
+        }
+        if (it == arena.priority_classes.end() || it->first != priority) {
+            it = arena.priority_classes.insert(it, {priority, Mask(0)});
+        }
+        it->second |= bit<Mask>(v);
+    }
+
+    return arena;
+}
+
+/**
+ * @brief Compute the attractor of a player to a target set inside a region
+ *
+ * The attractor is grown layer by layer: the candidates of a layer are the
+ * predecessors of the previous layer, a candidate owned by the player joins if it
+ * has a successor in the attractor, an opponent candidate joins once all of its
+ * successors inside the region are attracted.
+ *
+ * @param arena Bitmask arena
+ * @param player1 Vertices owned by player 1
+ * @param region Vertices of the (sub)game
+ * @param target Target set
+ * @param player Player computing the attractor (0 or 1)
+ * @param strategy Optional per-vertex array; receives an attracting successor for
+ *                 every player vertex added to the attractor
+ * @return Attractor set (subset of region)
+ */
+template <typename Mask>
+inline Mask attractor(const Arena<Mask> &arena, Mask player1, Mask region, Mask target, int player,
+                      int *strategy = nullptr) {
+    const Mask player_vertices = player == 1 ? player1 : ~player1;
+    Mask attracted = target & region;
+    Mask frontier = attracted;
+
+    while (frontier) {
+        Mask candidates = 0;
+        for_each_vertex(frontier, [&](int v) { candidates |= arena.predecessors[v]; });
+        candidates &= region & ~attracted;
+
+        Mask added = 0;
+        for_each_vertex(candidates, [&](int v) {
+            if (player_vertices & bit<Mask>(v)) {
+                added |= bit<Mask>(v);
+                if (strategy != nullptr) {
+                    strategy[v] = lowest_bit(arena.successors[v] & attracted);
+                }
+            } else if ((arena.successors[v] & region & ~attracted) == 0) {
+                added |= bit<Mask>(v);
+            }
+        });
+
+        attracted |= added;
+        frontier = added;
+    }
+
+    return attracted;
+}
+
+/**
+ * @brief Compute the ownership-independent core of every attractor to a target set
+ *
+ * Least fixpoint of the target set and the vertices of the region with a successor in
+ * the region, all of which are in the set. Such vertices are attracted whoever owns
+ * them, so the core is part of the attractor of either player under every ownership,
+ * and starting an attractor from the core instead of the target gives the same result.
+ *
+ * @param arena Bitmask arena
+ * @param region Vertices of the (sub)game
+ * @param target Target set
+ * @return Core (contains target & region)
+ */
+template <typename Mask>
+inline Mask attractor_core(const Arena<Mask> &arena, Mask region, Mask target) {
+    Mask core = target & region;
+    Mask frontier = core;
+
+    while (frontier) {
+        Mask candidates = 0;
+        for_each_vertex(frontier, [&](int v) { candidates |= arena.predecessors[v]; });
+        candidates &= region & ~core;
+
+        Mask added = 0;
+        for_each_vertex(candidates, [&](int v) {
+            if ((arena.successors[v] & region & ~core) == 0) {
+                added |= bit<Mask>(v);
+            }
+        });
+
+        core |= added;
+        frontier = added;
+    }
+
+    return core;
+}
+
+/**
+ * @brief Solve a reachability game (player 0 wants to reach priority 1 vertices)
+ * @return Player 0 winning region
+ */
+template <typename Mask>
+inline Mask solve_reachability(const Arena<Mask> &arena, Mask player1, int *strategy = nullptr) {
+    return attractor(arena, player1, arena.vertices, arena.with_priority(1), 0, strategy);
+}
+
+/**
+ * @brief Solve a reachability game starting from a precomputed attractor core
+ *
+ * Meant for solving many ownerships of one arena: the core is computed once with
+ * attractor_core(arena, arena.vertices, arena.with_priority(1)) and every solve only
+ * grows the ownership-dependent rest.
+ *
+ * @param core Ownership-independent core of the player 0 attractor
+ * @param strategy Optional per-vertex array, as for solve_reachability
+ * @return Player 0 winning region
+ */
+template <typename Mask>
+inline Mask solve_reachability_from(const Arena<Mask> &arena, Mask player1, Mask core, int *strategy = nullptr) {
+    if (strategy != nullptr) {
+        // Every successor of a core vertex outside the target joined the core before it
+        for_each_vertex(core & ~arena.with_priority(1) & ~player1,
+                        [&](int v) { strategy[v] = lowest_bit(arena.successors[v]); });
+    }
+    return attractor(arena, player1, arena.vertices, core, 0, strategy);
+}
+
+/**
+ * @brief Solve a Buchi game (priorities 0 and 1) with the iterated attractor algorithm
+ *
+ * Mirrors BuchiSolver: player 1 wins by visiting priority 1 vertices infinitely often,
+ * player 0 wins the attractor of the region where player 1 can no longer force a visit.
+ *
+ * @return Player 0 winning region
+ */
+template <typename Mask>
+inline Mask solve_buchi(const Arena<Mask> &arena, Mask player1) {
+    const Mask accepting = arena.with_priority(1);
+    Mask active = arena.vertices;
+    Mask won_by_player0 = 0;
+
+    while (active) {
+        const Mask player1_attractor = attractor(arena, player1, active, accepting, 1);
+        const Mask avoiding = active & ~player1_attractor;
+        if (!avoiding) {
+            break;
+        }
+        const Mask player0_attractor = attractor(arena, player1, active, avoiding, 0);
+        won_by_player0 |= player0_attractor;
+        active &= ~player0_attractor;
+    }
+
+    return won_by_player0;
+}
+
+/**
+ * @brief Counters collected by the recursive parity kernel
+ */
+struct ParityStatistics {
+    std::size_t max_depth = 0;
+    std::size_t subgames = 0;
+};
+
+/**
+ * @brief Zielonka's recursive algorithm on a region of the arena
+ * @param arena Bitmask arena
+ * @param player1 Vertices owned by player 1
+ * @param region Vertices of the subgame (must be a trap-closed subgame)
+ * @param strategy Optional per-vertex array receiving winning moves; entries are only
+ *                 meaningful for vertices owned by the player winning them
+ * @param statistics Optional recursion counters
+ * @param depth Current recursion depth
+ * @return Player 0 winning region inside the given region
+ */
+template <typename Mask>
+Mask solve_parity_in(const Arena<Mask> &arena, Mask player1, Mask region, int *strategy = nullptr,
+                     ParityStatistics *statistics = nullptr, std::size_t depth = 0) {
+    if (statistics != nullptr && depth > statistics->max_depth) {
+        statistics->max_depth = depth;
+    }
+    if (!region) {
+        return 0;
+    }
+
+    auto priority_class = arena.priority_classes.begin();
+    while ((priority_class->second & region) == 0) {
+        ++priority_class;
+    }
+    const int player = priority_class->first % 2;
+    const Mask top = priority_class->second & region;
+
+    const Mask player_attractor = attractor(arena, player1, region, top, player, strategy);
+    if (statistics != nullptr) {
+        statistics->subgames++;
+    }
+    const Mask sub_region = region & ~player_attractor;
+    const Mask sub_won0 = solve_parity_in(arena, player1, sub_region, strategy, statistics, depth + 1);
+    const Mask opponent_won = player == 0 ? sub_region & ~sub_won0 : sub_won0;
+
+    if (!opponent_won) {
+        // The player wins everything; vertices of top priority just stay in the region
+        if (strategy != nullptr) {
+            const Mask owned = player == 1 ? player1 : ~player1;
+            for_each_vertex(top & owned, [&](int v) {
+                if (arena.successors[v] & region) {
+                    strategy[v] = lowest_bit(arena.successors[v] & region);
+                }
+            });
+        }
+        return player == 0 ? region : Mask(0);
+    }
+
+    const Mask opponent_attractor = attractor(arena, player1, region, opponent_won, 1 - player, strategy);
+    if (statistics != nullptr) {
+        statistics->subgames++;
+    }
+    const Mask rest_won0 = solve_parity_in(arena, player1, region & ~opponent_attractor, strategy, statistics, depth + 1);
+    return player == 0 ? rest_won0 : (opponent_attractor | rest_won0);
+}
+
+/**
+ * @brief Solve a parity game (max-priority, even priorities won by player 0)
+ * @return Player 0 winning region
+ */
+template <typename Mask>
+inline Mask solve_parity(const Arena<Mask> &arena, Mask player1, int *strategy = nullptr,
+                         ParityStatistics *statistics = nullptr) {
+    return solve_parity_in(arena, player1, arena.vertices, strategy, statistics, 0);
+}
+
+} // namespace bitboard
+} // namespace solvers
+} // namespace ggg
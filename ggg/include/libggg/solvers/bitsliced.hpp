@@ -0,0 +1,571 @@
+#pragma once
+
+#include "libggg/graphs/parity_graph.hpp"
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+namespace ggg {
+namespace solvers {
+namespace bitsliced {
+
+/**
+ * @brief Bitsliced kernels solving one arena under 64 ownership assignments at once
+ *
+ * A vertex set is stored as one 64-bit word per vertex; bit l of the word for vertex v
+ * says whether v belongs to the set in lane l. Ownership is itself such a set (the
+ * player 1 vertices of every lane), so attractors and Zielonka's recursion run for all
+ * lanes in the same pass. The recursion is driven by the union of lanes that still have
+ * work; finished lanes are masked off.
+ */
+
+using Lanes = std::uint64_t;
+using SlicedSet = std::vector<Lanes>;
+
+/**
+ * @brief Number of ownership assignments solved per pass
+ */
+inline constexpr int lane_count = 64;
+
+/**
+ * @brief Lane mask with the first count lanes set
+ */
+inline constexpr Lanes first_lanes(int count) {
+    return count >= lane_count ? ~Lanes(0) : (Lanes(1) << count) - 1;
+}
+
+/**
+ * @brief Compressed adjacency of a parity arena shared by all lanes
+ */
+struct Arena {
+    int num_vertices = 0;
+    std::vector<int> successor_offsets;   ///< Size num_vertices + 1
+    std::vector<int> successors;          ///< Successors of v in [successor_offsets[v], successor_offsets[v + 1])
+    std::vector<int> predecessor_offsets; ///< Size num_vertices + 1
+    std::vector<int> predecessors;        ///< Predecessors of v in [predecessor_offsets[v], predecessor_offsets[v + 1])
+    std::vector<int> priority;            ///< Priority of every vertex
+    std::vector<std::pair<int, std::vector<int>>> priority_classes; ///< (priority, vertices) by decreasing priority
+};
+
+/**
+ * @brief Build the compressed arena of a parity graph
+ */
+inline Arena make_arena(const graphs::ParityGraph &graph) {
+    Arena arena;
+    const int n = static_cast<int>(boost::num_vertices(graph));
+    arena.num_vertices = n;
+    arena.priority.resize(n);
+    arena.successor_offsets.assign(n + 1, 0);
+    arena.predecessor_offsets.assign(n + 1, 0);
+
+    const auto [edges_begin, edges_end] = boost::edges(graph);
+    for (const auto &edge : boost::make_iterator_range(edges_begin, edges_end)) {
+        arena.successor_offsets[boost::source(edge, graph) + 1]++;
+        arena.predecessor_offsets[boost::target(edge, graph) + 1]++;
+    }
+    for (int v = 0; v < n; ++v) {
+        arena.successor_offsets[v + 1] += arena.successor_offsets[v];
+        arena.predecessor_offsets[v + 1] += arena.predecessor_offsets[v];
+    }
+
+    arena.successors.resize(arena.successor_offsets[n]);
+    arena.predecessors.resize(arena.predecessor_offsets[n]);
+    std::vector<int> successor_fill(arena.successor_offsets.begin(), arena.successor_offsets.end() - 1);
+    std::vector<int> predecessor_fill(arena.predecessor_offsets.begin(), arena.predecessor_offsets.end() - 1);
+    for (int v = 0; v < n; ++v) {
+        const auto [out_begin, out_end] = boost::out_edges(v, graph);
+        for (const auto &edge : boost::make_iterator_range(out_begin, out_end)) {
+            const int w = static_cast<int>(boost::target(edge, graph));
+            arena.successors[successor_fill[v]++] = w;
+            arena.predecessors[predecessor_fill[w]++] = v;
+        }
+    }
+
+    for (int v = 0; v < n; ++v) {
+        const int p = graph[v].priority;
+        arena.priority[v] = p;
+        auto it = arena.priority_classes.begin();
+        while (it != arena.priority_classes.end() && it->first > p) {
+            ++it;
+        }
+        if (it == arena.priority_classes.end() || it->first != p) {
+            it = arena.priority_classes.insert(it, {p, {}});
+        }
+        it->second.push_back(v);
+    }
+
+    return arena;
+}
+
+/**
+ * @brief Per-lane edge presence and priorities layered over an arena
+ *
+ * Lets the kernels solve 64 variants of one arena, with edges dropped or priorities
+ * changed per lane, without rebuilding it. An empty member leaves the arena's edges or
+ * priorities in place. Absent edges are skipped as if they were not in the arena, so a
+ * vertex that loses all of its edges in a lane becomes a dead end there; samplers keep one
+ * present edge per vertex and lane (see ownership::draw_edges).
+ */
+struct Overlay {
+    SlicedSet present; ///< Lanes in which each edge, indexed like Arena::successors, is present
+    std::vector<std::pair<int, SlicedSet>> priority_classes; ///< (priority, lanes in which each vertex has it) by decreasing priority
+};
+
+/**
+ * @brief Give every vertex its priority from an override array in the given lanes
+ *
+ * The lanes are cleared from the classes the vertices had before, so a batch can be
+ * overwritten lane by lane; classes left empty are kept.
+ *
+ * @param overlay Overlay to update
+ * @param priority Priority of every vertex
+ * @param lanes Lanes taking the priorities
+ */
+inline void set_priorities(Overlay &overlay, const std::vector<int> &priority, Lanes lanes) {
+    const int n = static_cast<int>(priority.size());
+    for (auto &[p, members] : overlay.priority_classes) {
+        for (int v = 0; v < n; ++v) {
+            members[v] &= ~lanes;
+        }
+    }
+    for (int v = 0; v < n; ++v) {
+        auto it = overlay.priority_classes.begin();
+        while (it != overlay.priority_classes.end() && it->first > priority[v]) {
+            ++it;
+        }
+        if (it == overlay.priority_classes.end() || it->first != priority[v]) {
+            it = overlay.priority_classes.insert(it, {priority[v], SlicedSet(n, 0)});
+        }
+        it->second[v] |= lanes;
+    }
+}
+
+/**
+ * @brief Lanes in which every vertex has the given priority, under the overlay's priorities if it has any
+ */
+inline SlicedSet with_priority(const Arena &arena, const Overlay *overlay, int priority) {
+    const int n = arena.num_vertices;
+    if (overlay != nullptr && !overlay->priority_classes.empty()) {
+        for (const auto &[p, members] : overlay->priority_classes) {
+            if (p == priority) {
+                return members;
+            }
+        }
+        return SlicedSet(n, 0);
+    }
+    SlicedSet members(n, 0);
+    for (int v = 0; v < n; ++v) {
+        if (arena.priority[v] == priority) {
+            members[v] = ~Lanes(0);
+        }
+    }
+    return members;
+}
+
+/**
+ * @brief Compute the attractor of a player to a target set inside a region, in every lane
+ *
+ * Sweeps over the vertices until nothing changes; a vertex v gains the lanes where it
+ * has a successor in the attractor and either belongs to the player or has all of its
+ * successors inside the region attracted. Each sweep updates in place, so on the small
+ * dense arenas of the experiments a handful of sweeps suffice. As in the scalar
+ * solvers, vertices without successors in the region are never attracted. Edges absent
+ * in a lane of the overlay count neither as a way in nor as a way out.
+ *
+ * @param arena Compressed arena
+ * @param player1 Player 1 vertices per lane
+ * @param region Vertices of the (sub)game per lane
+ * @param target Target set per lane
+ * @param player Player computing the attractor (0 or 1)
+ * @param overlay Optional edge presence per lane
+ * @return Attractor per lane (subset of region)
+ */
+inline SlicedSet attractor(const Arena &arena, const SlicedSet &player1, const SlicedSet &region,
+                           const SlicedSet &target, int player, const Overlay *overlay = nullptr) {
+    const int n = arena.num_vertices;
+    const Lanes *present = overlay != nullptr && !overlay->present.empty() ? overlay->present.data() : nullptr;
+    SlicedSet attracted(n);
+    for (int v = 0; v < n; ++v) {
+        attracted[v] = target[v] & region[v];
+    }
+
+    bool changed = true;
+    while (changed) {
+        changed = false;
+        for (int v = n - 1; v >= 0; --v) {
+            const Lanes open = region[v] & ~attracted[v];
+            if (!open) {
+                continue;
+            }
+
+            Lanes exists = 0;
+            Lanes all = ~Lanes(0);
+            for (int s = arena.successor_offsets[v]; s < arena.successor_offsets[v + 1]; ++s) {
+                const int u = arena.successors[s];
+                const Lanes edge = present != nullptr ? present[s] : ~Lanes(0);
+                exists |= attracted[u] & edge;
+                all &= attracted[u] | ~region[u] | ~edge;
+            }
+
+            const Lanes owned = player == 1 ? player1[v] : ~player1[v];
+            const Lanes added = open & exists & (owned | all);
+            if (added) {
+                attracted[v] |= added;
+                changed = true;
+            }
+        }
+    }
+
+    return attracted;
+}
+
+/**
+ * @brief Compute the attractors of up to 64 target sets under one ownership in a single pass
+ *
+ * Lane l of targets is the l-th target set. Lanes newly attracted at a vertex are pushed
+ * to its predecessors once: a player vertex takes them over directly, an opponent vertex
+ * decrements a per-lane counter of successors not yet attracted and joins a lane when
+ * the counter reaches zero. Every (edge, lane) pair is thus handled at most once, instead
+ * of one traversal per target set. Counters are only allocated for opponent vertices
+ * that are actually reached.
+ *
+ * @param arena Compressed arena
+ * @param player1 Owner flags (non-zero for player 1), shared by all lanes
+ * @param region Vertices of the (sub)game (non-zero for members), shared by all lanes
+ * @param targets Target sets, one lane per set
+ * @param player Player computing the attractors (0 or 1)
+ * @return Attractor of every target set, one lane per set
+ */
+inline SlicedSet attractors(const Arena &arena, const std::vector<char> &player1, const std::vector<char> &region,
+                            const SlicedSet &targets, int player) {
+    const int n = arena.num_vertices;
+    SlicedSet attracted(n, 0);
+    SlicedSet pending(n, 0);
+    std::vector<int> worklist;
+    std::vector<int> counter_slot(n, -1);
+    std::vector<int> counters;
+
+    for (int v = 0; v < n; ++v) {
+        if (region[v] && targets[v]) {
+            attracted[v] = targets[v];
+            pending[v] = targets[v];
+            worklist.push_back(v);
+        }
+    }
+
+    while (!worklist.empty()) {
+        const int w = worklist.back();
+        worklist.pop_back();
+        const Lanes delta = pending[w];
+        pending[w] = 0;
+
+        for (int p = arena.predecessor_offsets[w]; p < arena.predecessor_offsets[w + 1]; ++p) {
+            const int v = arena.predecessors[p];
+            Lanes open = delta & ~attracted[v];
+            if (!region[v] || !open) {
+                continue;
+            }
+
+            Lanes added = 0;
+            if ((player1[v] != 0) == (player == 1)) {
+                added = open;
+            } else {
+                if (counter_slot[v] < 0) {
+                    int inside_region = 0;
+                    for (int s = arena.successor_offsets[v]; s < arena.successor_offsets[v + 1]; ++s) {
+                        inside_region += region[arena.successors[s]] ? 1 : 0;
+                    }
+                    counter_slot[v] = static_cast<int>(counters.size());
+                    counters.insert(counters.end(), lane_count, inside_region);
+                }
+                int *remaining = counters.data() + counter_slot[v];
+                while (open) {
+                    const int lane = std::countr_zero(open);
+                    if (--remaining[lane] == 0) {
+                        added |= Lanes(1) << lane;
+                    }
+                    open &= open - 1;
+                }
+            }
+
+            if (added) {
+                attracted[v] |= added;
+                if (!pending[v]) {
+                    worklist.push_back(v);
+                }
+                pending[v] |= added;
+            }
+        }
+    }
+
+    return attracted;
+}
+
+/**
+ * @brief Solve reachability games (player 0 wants to reach priority 1 vertices) in every lane
+ * @param arena Compressed arena
+ * @param player1 Player 1 vertices per lane
+ * @param lanes Lanes to solve
+ * @param overlay Optional edge presence and priorities per lane
+ * @return Player 0 winning region per lane
+ */
+inline SlicedSet solve_reachability(const Arena &arena, const SlicedSet &player1, Lanes lanes,
+                                    const Overlay *overlay = nullptr) {
+    const SlicedSet region(arena.num_vertices, lanes);
+    auto target = with_priority(arena, overlay, 1);
+    for (auto &word : target) {
+        word &= lanes;
+    }
+    return attractor(arena, player1, region, target, 0, overlay);
+}
+
+/**
+ * @brief Compute the ownership-independent core of the player 0 attractor to the priority 1 vertices
+ *
+ * Least fixpoint of the targets and the vertices with a successor, all of whose
+ * successors are in the set; these are attracted in every lane whoever owns them.
+ *
+ * @param arena Compressed arena
+ * @return Core, with every lane set for its members
+ */
+inline SlicedSet reachability_core(const Arena &arena) {
+    const int n = arena.num_vertices;
+    SlicedSet core(n, 0);
+    std::vector<int> remaining(n);
+    std::vector<int> worklist;
+    for (int v = 0; v < n; ++v) {
+        remaining[v] = arena.successor_offsets[v + 1] - arena.successor_offsets[v];
+        if (arena.priority[v] == 1) {
+            core[v] = ~Lanes(0);
+            worklist.push_back(v);
+        }
+    }
+    while (!worklist.empty()) {
+        const int v = worklist.back();
+        worklist.pop_back();
+        for (int p = arena.predecessor_offsets[v]; p < arena.predecessor_offsets[v + 1]; ++p) {
+            const int u = arena.predecessors[p];
+            if (!core[u] && --remaining[u] == 0) {
+                core[u] = ~Lanes(0);
+                worklist.push_back(u);
+            }
+        }
+    }
+    return core;
+}
+
+/**
+ * @brief Solve reachability games in every lane, starting from a precomputed reachability_core
+ *
+ * The core stays valid under an overlay that drops edges, as long as every vertex keeps a
+ * present edge: a core vertex then still has all of its moves into the core. It does not
+ * hold under overlay priorities.
+ *
+ * @return Player 0 winning region per lane
+ */
+inline SlicedSet solve_reachability_from(const Arena &arena, const SlicedSet &player1, Lanes lanes,
+                                         const SlicedSet &core, const Overlay *overlay = nullptr) {
+    const SlicedSet region(arena.num_vertices, lanes);
+    return attractor(arena, player1, region, core, 0, overlay);
+}
+
+/**
+ * @brief Solve Buchi games (priorities 0 and 1) in every lane
+ *
+ * Same iteration as BuchiSolver; a lane leaves the loop as soon as player 1 can
+ * force a visit to priority 1 vertices from all of its remaining vertices.
+ *
+ * @param overlay Optional edge presence and priorities per lane
+ * @return Player 0 winning region per lane
+ */
+inline SlicedSet solve_buchi(const Arena &arena, const SlicedSet &player1, Lanes lanes, const Overlay *overlay = nullptr) {
+    const int n = arena.num_vertices;
+    const auto priority1 = with_priority(arena, overlay, 1);
+    SlicedSet active(n, lanes);
+    SlicedSet won_by_player0(n, 0);
+    SlicedSet accepting(n, 0);
+    SlicedSet avoiding(n, 0);
+
+    while (true) {
+        for (int v = 0; v < n; ++v) {
+            accepting[v] = active[v] & priority1[v];
+        }
+        const auto player1_attractor = attractor(arena, player1, active, accepting, 1, overlay);
+
+        Lanes running = 0;
+        for (int v = 0; v < n; ++v) {
+            avoiding[v] = active[v] & ~player1_attractor[v];
+            running |= avoiding[v];
+        }
+        if (!running) {
+            break;
+        }
+
+        // Lanes without avoidable vertices are finished, player 1 wins what is left there
+        for (int v = 0; v < n; ++v) {
+            active[v] &= running;
+        }
+        const auto player0_attractor = attractor(arena, player1, active, avoiding, 0, overlay);
+        for (int v = 0; v < n; ++v) {
+            won_by_player0[v] |= player0_attractor[v];
+            active[v] &= ~player0_attractor[v];
+        }
+    }
+
+    return won_by_player0;
+}
+
+/**
+ * @brief Counters collected by the bitsliced parity kernel
+ */
+struct ParityStatistics {
+    std::size_t max_depth = 0;
+    std::size_t subgames = 0;
+};
+
+/**
+ * @brief Zielonka's recursive algorithm on a region, shared by all lanes
+ *
+ * The top priority is the highest priority present in any lane of the region. Lanes
+ * without a vertex of that priority skip it: their result is the result of the
+ * subgame. Only lanes where the opponent wins part of the subgame take the second
+ * recursion. Overlay priorities are read per lane: the top vertices of a lane are those
+ * with the top priority in that lane.
+ *
+ * @param arena Compressed arena
+ * @param player1 Player 1 vertices per lane
+ * @param region Vertices of the subgame per lane
+ * @param max_priority Priorities above this bound are absent from the region
+ * @param statistics Optional recursion counters
+ * @param depth Current recursion depth
+ * @param overlay Optional edge presence and priorities per lane
+ * @return Player 0 winning region per lane
+ */
+inline SlicedSet solve_parity_in(const Arena &arena, const SlicedSet &player1, const SlicedSet &region,
+                                 int max_priority, ParityStatistics *statistics = nullptr, std::size_t depth = 0,
+                                 const Overlay *overlay = nullptr) {
+    const int n = arena.num_vertices;
+    if (statistics != nullptr && depth > statistics->max_depth) {
+        statistics->max_depth = depth;
+    }
+
+    // Highest priority occurring in some lane of the region
+    int priority = 0;
+    Lanes top_lanes = 0;
+    SlicedSet top(n, 0);
+    if (overlay != nullptr && !overlay->priority_classes.empty()) {
+        for (const auto &[p, members] : overlay->priority_classes) {
+            if (p > max_priority) {
+                continue;
+            }
+            for (int v = 0; v < n; ++v) {
+                top[v] = region[v] & members[v];
+                top_lanes |= top[v];
+            }
+            if (top_lanes) {
+                priority = p;
+                break;
+            }
+        }
+    } else {
+        auto priority_class = arena.priority_classes.begin();
+        for (; priority_class != arena.priority_classes.end(); ++priority_class) {
+            if (priority_class->first > max_priority) {
+                continue;
+            }
+            for (const int v : priority_class->second) {
+                top_lanes |= region[v];
+            }
+            if (top_lanes) {
+                break;
+            }
+        }
+        if (top_lanes) {
+            priority = priority_class->first;
+            for (const int v : priority_class->second) {
+                top[v] = region[v];
+            }
+        }
+    }
+    if (!top_lanes) {
+        return SlicedSet(n, 0);
+    }
+
+    const int player = priority % 2;
+    const auto player_attractor = attractor(arena, player1, region, top, player, overlay);
+    if (statistics != nullptr) {
+        statistics->subgames++;
+    }
+    SlicedSet sub_region(n);
+    for (int v = 0; v < n; ++v) {
+        sub_region[v] = region[v] & ~player_attractor[v];
+    }
+    const auto sub_won0 = solve_parity_in(arena, player1, sub_region, priority - 1, statistics, depth + 1, overlay);
+
+    // Lanes where the opponent wins some of the subgame need a second recursion
+    SlicedSet opponent_won(n);
+    Lanes opponent_lanes = 0;
+    for (int v = 0; v < n; ++v) {
+        opponent_won[v] = sub_region[v] & (player == 0 ? ~sub_won0[v] : sub_won0[v]) & top_lanes;
+        opponent_lanes |= opponent_won[v];
+    }
+
+    SlicedSet won0(n);
+    const Lanes player_wins_all = top_lanes & ~opponent_lanes;
+    for (int v = 0; v < n; ++v) {
+        won0[v] = sub_won0[v] & ~top_lanes;
+        if (player == 0) {
+            won0[v] |= region[v] & player_wins_all;
+        }
+    }
+    if (!opponent_lanes) {
+        return won0;
+    }
+
+    SlicedSet opponent_region(n);
+    for (int v = 0; v < n; ++v) {
+        opponent_region[v] = region[v] & opponent_lanes;
+    }
+    const auto opponent_attractor = attractor(arena, player1, opponent_region, opponent_won, 1 - player, overlay);
+    if (statistics != nullptr) {
+        statistics->subgames++;
+    }
+    SlicedSet rest(n);
+    for (int v = 0; v < n; ++v) {
+        rest[v] = opponent_region[v] & ~opponent_attractor[v];
+    }
+    const auto rest_won0 = solve_parity_in(arena, player1, rest, priority, statistics, depth + 1, overlay);
+    for (int v = 0; v < n; ++v) {
+        won0[v] |= rest_won0[v];
+        if (player == 1) {
+            won0[v] |= opponent_attractor[v];
+        }
+    }
+    return won0;
+}
+
+/**
+ * @brief Solve parity games (max-priority, even priorities won by player 0) in every lane
+ * @param arena Compressed arena
+ * @param player1 Player 1 vertices per lane
+ * @param lanes Lanes to solve
+ * @param statistics Optional recursion counters
+ * @param overlay Optional edge presence and priorities per lane
+ * @return Player 0 winning region per lane
+ */
+inline SlicedSet solve_parity(const Arena &arena, const SlicedSet &player1, Lanes lanes,
+                              ParityStatistics *statistics = nullptr, const Overlay *overlay = nullptr) {
+    const bool overlaid = overlay != nullptr && !overlay->priority_classes.empty();
+    if (!overlaid && arena.priority_classes.empty()) {
+        return SlicedSet(arena.num_vertices, 0);
+    }
+    const int max_priority = overlaid ? overlay->priority_classes.front().first : arena.priority_classes.front().first;
+    const SlicedSet region(arena.num_vertices, lanes);
+    return solve_parity_in(arena, player1, region, max_priority, statistics, 0, overlay);
+}
+
+} // namespace bitsliced
+} // namespace solvers
+} // namespace ggg
@@ -0,0 +1,238 @@
+#pragma once
+
+#include "libggg/solvers/bitsliced.hpp"
+#include <algorithm>
+#include <coroutine>
+#include <cstdint>
+#include <exception>
+#include <utility>
+#include <vector>
+
+namespace ggg {
+namespace solvers {
+namespace interleaved {
+
+/**
+ * @brief Interleaved execution of many small solves on one thread
+ *
+ * On arenas larger than the L2 cache a worklist solve stalls on a cache miss at almost
+ * every edge it follows. Written as C++20 coroutines, K independent solves (different
+ * ownership samples or different games) prefetch the memory of their next step and
+ * suspend; the executor resumes them round-robin, so the misses of one solve overlap with
+ * the work of the others (asynchronous memory access chaining). The algorithms themselves
+ * are unchanged.
+ */
+
+/**
+ * @brief Coroutine of one solve, started and resumed by the executor
+ */
+class Task {
+  public:
+    struct promise_type {
+        std::exception_ptr exception;
+
+        Task get_return_object() { return Task(std::coroutine_handle<promise_type>::from_promise(*this)); }
+        std::suspend_always initial_suspend() noexcept { return {}; }
+        std::suspend_always final_suspend() noexcept { return {}; }
+        void return_void() {}
+        void unhandled_exception() { exception = std::current_exception(); }
+    };
+
+    Task() = default;
+    Task(Task &&other) noexcept : handle_(std::exchange(other.handle_, {})) {}
+    Task &operator=(Task &&other) noexcept {
+        if (this != &other) {
+            reset();
+            handle_ = std::exchange(other.handle_, {});
+        }
+        return *this;
+    }
+    Task(const Task &) = delete;
+    Task &operator=(const Task &) = delete;
+    ~Task() { reset(); }
+
+    /**
+     * @brief Whether the solve has returned (or there is none)
+     */
+    [[nodiscard]] bool done() const { return !handle_ || handle_.done(); }
+
+    /**
+     * @brief Run the solve up to its next suspension, rethrowing anything it threw
+     */
+    void resume() {
+        handle_.resume();
+        if (handle_.done() && handle_.promise().exception) {
+            std::rethrow_exception(handle_.promise().exception);
+        }
+    }
+
+  private:
+    explicit Task(std::coroutine_handle<promise_type> handle) : handle_(handle) {}
+
+    void reset() {
+        if (handle_) {
+            handle_.destroy();
+            handle_ = {};
+        }
+    }
+
+    std::coroutine_handle<promise_type> handle_;
+};
+
+/**
+ * @brief Awaitable that prefetches an address and yields to the other solves
+ */
+struct Prefetch {
+    const void *address;
+
+    bool await_ready() const noexcept { return false; }
+    void await_suspend(std::coroutine_handle<>) const noexcept { __builtin_prefetch(address); }
+    void await_resume() const noexcept {}
+};
+
+/**
+ * @brief co_await prefetch(p) starts loading p and resumes once every other solve had a turn
+ */
+inline Prefetch prefetch(const void *address) {
+    return Prefetch{address};
+}
+
+/**
+ * @brief Run count solves with at most width of them in flight, resumed round-robin
+ *
+ * make(index, slot) creates solve index; slot, in [0, width), is the position the solve
+ * occupies while it runs and is reused by a later solve once it returns, so per-solve
+ * workspaces can be indexed by it. Solves start in index order.
+ *
+ * @param count Number of solves
+ * @param width Solves in flight (at least 1)
+ * @param make Function (int index, int slot) -> Task
+ * @return Number of resumptions
+ */
+template <typename Make>
+inline long run(int count, int width, Make &&make) {
+    if (count <= 0) {
+        return 0;
+    }
+    std::vector<Task> flight(static_cast<std::size_t>(std::clamp(width, 1, count)));
+    int next = 0;
+    int running = 0;
+    for (int slot = 0; slot < static_cast<int>(flight.size()); ++slot) {
+        flight[slot] = make(next++, slot);
+        running++;
+    }
+    long resumptions = 0;
+    while (running > 0) {
+        for (int slot = 0; slot < static_cast<int>(flight.size()); ++slot) {
+            if (flight[slot].done()) {
+                continue;
+            }
+            flight[slot].resume();
+            resumptions++;
+            if (flight[slot].done()) {
+                if (next < count) {
+                    flight[slot] = make(next++, slot);
+                } else {
+                    running--;
+                }
+            }
+        }
+    }
+    return resumptions;
+}
+
+/**
+ * @brief Per-solve state of reachability, reused across solves
+ *
+ * Vertices are touched lazily: a vertex whose stamp is not the current epoch has not been
+ * seen by this solve, so no per-solve clearing pass over the arena is needed.
+ */
+struct Workspace {
+    struct State {
+        std::uint32_t stamp = 0;
+        std::int32_t remaining = 0; ///< Successors not yet attracted; at most 0 once attracted
+    };
+    std::vector<State> state;
+    std::vector<int> worklist;
+    std::uint32_t epoch = 0;
+
+    /**
+     * @brief Start a new solve on an arena of n vertices
+     */
+    void begin(int n) {
+        if (state.size() != static_cast<std::size_t>(n) || ++epoch == 0) {
+            state.assign(n, State{});
+            epoch = 1;
+        }
+        worklist.clear();
+    }
+};
+
+/**
+ * @brief Decide whether player 0 reaches the priority 1 vertices from a query vertex, as a coroutine
+ *
+ * The backward worklist attractor of ReachabilitySolver under the ownership of one lane of
+ * a bitsliced sample, seeded with the ownership-independent reachability_core. Before
+ * visiting the predecessors of a vertex and before updating each predecessor it
+ * prefetches their memory and suspends. It returns as soon as the query is attracted.
+ *
+ * @param arena Compressed arena
+ * @param player1 Player 1 vertices per lane
+ * @param lane Lane holding the ownership to solve
+ * @param core Core vertices (reachability_core members)
+ * @param query Vertex whose winner is wanted
+ * @param workspace Workspace owned by this solve until it returns
+ * @param won Set to whether player 0 wins from query
+ */
+inline Task reachability(const bitsliced::Arena &arena, const bitsliced::SlicedSet &player1, int lane,
+                         const std::vector<int> &core, int query, Workspace &workspace, bool &won) {
+    workspace.begin(arena.num_vertices);
+    const std::uint32_t epoch = workspace.epoch;
+    auto &state = workspace.state;
+    auto &worklist = workspace.worklist;
+    won = false;
+    for (const int v : core) {
+        state[v] = {epoch, 0};
+        worklist.push_back(v);
+        won = won || v == query;
+    }
+
+    while (!won && !worklist.empty()) {
+        const int w = worklist.back();
+        worklist.pop_back();
+        const int first = arena.predecessor_offsets[w];
+        const int last = arena.predecessor_offsets[w + 1];
+        if (first == last) {
+            continue;
+        }
+        co_await prefetch(&arena.predecessors[first]);
+
+        for (int p = first; p < last; ++p) {
+            const int v = arena.predecessors[p];
+            __builtin_prefetch(&player1[v]);
+            __builtin_prefetch(&arena.successor_offsets[v]);
+            co_await prefetch(&state[v]);
+
+            auto &entry = state[v];
+            if (entry.stamp != epoch) {
+                entry = {epoch, arena.successor_offsets[v + 1] - arena.successor_offsets[v]};
+            } else if (entry.remaining <= 0) {
+                continue;
+            }
+            const bool player0 = !((player1[v] >> lane) & 1);
+            if (player0 || --entry.remaining == 0) {
+                entry.remaining = 0;
+                if (v == query) {
+                    won = true;
+                    break;
+                }
+                __builtin_prefetch(&arena.predecessor_offsets[v]);
+                worklist.push_back(v);
+            }
+        }
+    }
+}
+
+} // namespace interleaved
+} // namespace solvers
+} // namespace ggg
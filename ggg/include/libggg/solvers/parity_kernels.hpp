@@ -0,0 +1,383 @@
+#pragma once
+
+#include "libggg/graphs/parity_graph.hpp"
+#include "libggg/graphs/priority_utilities.hpp"
+#include "libggg/solvers/bitboard.hpp"
+#include "libggg/solvers/bitsliced.hpp"
+#include <array>
+#include <cstddef>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace ggg {
+namespace solvers {
+namespace parity_kernels {
+
+/**
+ * @brief Specialised parity kernels for the game classes we solve most
+ *
+ * Reachability, Buchi and co-Buchi games and their small generalisations are parity
+ * games whose priorities compress to at most four values. Such arenas are solved by
+ * Zielonka's algorithm with the recursion on the top priority unrolled at compile time:
+ * solve_in<1> is the attractor-free base case, solve_in<2> is the iterated attractor
+ * algorithm of Buchi games and solve_in<4> nests at most three attractor levels. Regions
+ * are vertex lists stamped with a label per recursion frame, so no subgame is copied,
+ * and attractors reuse per-vertex counters of a workspace allocated once per solve.
+ *
+ * solve() is the dispatcher: arenas of at most 128 vertices go to the bitboard kernel,
+ * larger arenas with at most max_levels compressed priorities to solve_levels<2> or
+ * solve_levels<4>, and everything else is left to the caller's generic algorithm.
+ */
+
+/**
+ * @brief Most compressed priorities handled by the specialised kernels
+ */
+inline constexpr int max_levels = 4;
+
+/**
+ * @brief Compressed arena with one level per run of equal-parity priorities
+ */
+struct Arena : bitsliced::Arena {
+    std::vector<char> player1; ///< Whether player 1 owns each vertex
+    std::vector<int> level;    ///< Compressed priority of every vertex, counted from 0
+    int levels = 0;            ///< Number of levels
+    int parity = 0;            ///< Parity of the lowest priority: level l belongs to player (l + parity) % 2
+};
+
+/**
+ * @brief Build the compressed arena of a parity graph
+ */
+inline Arena make_arena(const graphs::ParityGraph &graph) {
+    Arena arena;
+    static_cast<bitsliced::Arena &>(arena) = bitsliced::make_arena(graph);
+    const int n = arena.num_vertices;
+    arena.player1.resize(n);
+    for (int v = 0; v < n; ++v) {
+        arena.player1[v] = graph[v].player == 1;
+    }
+
+    // Classes are sorted by decreasing priority; a new level starts at every parity change
+    arena.level.resize(n);
+    int previous_parity = -1;
+    for (auto it = arena.priority_classes.rbegin(); it != arena.priority_classes.rend(); ++it) {
+        const int parity = it->first % 2;
+        if (previous_parity == -1) {
+            arena.parity = parity;
+            arena.levels = 1;
+        } else if (parity != previous_parity) {
+            arena.levels++;
+        }
+        previous_parity = parity;
+        for (const int v : it->second) {
+            arena.level[v] = arena.levels - 1;
+        }
+    }
+    return arena;
+}
+
+/**
+ * @brief Winners, winning moves and recursion counters of a solve
+ */
+struct Result {
+    std::vector<int> winner;   ///< Winner of every vertex
+    std::vector<int> strategy; ///< Winning successor of every vertex owned by its winner, -1 otherwise
+    bitboard::ParityStatistics statistics;
+};
+
+namespace detail {
+
+/**
+ * @brief Labels, attractor marks and counters shared by all recursion frames
+ */
+struct Workspace {
+    const Arena &arena;
+    Result &result;
+    std::vector<int> label;      ///< Label of the innermost region containing each vertex
+    std::vector<int> mark;       ///< Mark of the last attractor each vertex joined
+    std::vector<int> count;      ///< Successors left outside the attractor, for opponent vertices
+    std::vector<int> count_mark; ///< Attractor for which count is valid
+    int next_label = 0;
+    int next_mark = 0;
+
+    Workspace(const Arena &arena, Result &result)
+        : arena(arena), result(result), label(arena.num_vertices, 0), mark(arena.num_vertices, 0),
+          count(arena.num_vertices, 0), count_mark(arena.num_vertices, 0) {}
+
+    int player_of(int level) const { return (level + arena.parity) % 2; }
+
+    /**
+     * @brief Label the vertices of a region as the region of a new frame
+     * @return The new label
+     */
+    int stamp(const std::vector<int> &region) {
+        const int fresh = ++next_label;
+        for (const int v : region) {
+            label[v] = fresh;
+        }
+        return fresh;
+    }
+
+    /**
+     * @brief First successor inside the labelled region, or -1
+     */
+    int successor_in(int v, int region) const {
+        for (int s = arena.successor_offsets[v]; s < arena.successor_offsets[v + 1]; ++s) {
+            if (label[arena.successors[s]] == region) {
+                return arena.successors[s];
+            }
+        }
+        return -1;
+    }
+
+    /**
+     * @brief Attractor of a player to a target inside the labelled region
+     *
+     * Player vertices record the successor that attracted them in result.strategy.
+     *
+     * @param attracted Receives the attractor, target first
+     * @return Mark of the attractor: v is attracted iff mark[v] equals it
+     */
+    int attract(const std::vector<int> &target, int region, int player, std::vector<int> &attracted) {
+        const int current = ++next_mark;
+        attracted = target;
+        for (const int v : target) {
+            mark[v] = current;
+        }
+        for (std::size_t i = 0; i < attracted.size(); ++i) {
+            const int v = attracted[i];
+            for (int p = arena.predecessor_offsets[v]; p < arena.predecessor_offsets[v + 1]; ++p) {
+                const int u = arena.predecessors[p];
+                if (label[u] != region || mark[u] == current) {
+                    continue;
+                }
+                if (arena.player1[u] == player) {
+                    result.strategy[u] = v;
+                } else {
+                    if (count_mark[u] != current) {
+                        count_mark[u] = current;
+                        count[u] = 0;
+                        for (int s = arena.successor_offsets[u]; s < arena.successor_offsets[u + 1]; ++s) {
+                            count[u] += label[arena.successors[s]] == region;
+                        }
+                    }
+                    if (--count[u] > 0) {
+                        continue;
+                    }
+                }
+                mark[u] = current;
+                attracted.push_back(u);
+            }
+        }
+        return current;
+    }
+};
+
+/**
+ * @brief Zielonka's algorithm on a region whose vertices all have levels below Levels
+ *
+ * The second recursive call of Zielonka's algorithm, on the region left after removing
+ * the opponent's attractor, is a loop; the first descends one level at compile time.
+ */
+template <int Levels>
+void solve_in(Workspace &workspace, std::vector<int> region, std::size_t depth) {
+    auto &result = workspace.result;
+    auto &statistics = result.statistics;
+    std::vector<int> top;
+    std::vector<int> attracted;
+    std::vector<int> sub_region;
+    std::vector<int> opponent_won;
+
+    while (!region.empty()) {
+        if (depth > statistics.max_depth) {
+            statistics.max_depth = depth;
+        }
+        const int label = workspace.stamp(region);
+
+        if constexpr (Levels == 1) {
+            // One priority: its player wins by staying in the region
+            const int player = workspace.player_of(0);
+            for (const int v : region) {
+                result.winner[v] = player;
+                if (workspace.arena.player1[v] == player) {
+                    result.strategy[v] = workspace.successor_in(v, label);
+                }
+            }
+            return;
+        } else {
+            top.clear();
+            for (const int v : region) {
+                if (workspace.arena.level[v] == Levels - 1) {
+                    top.push_back(v);
+                }
+            }
+            if (top.empty()) {
+                solve_in<Levels - 1>(workspace, std::move(region), depth);
+                return;
+            }
+
+            const int player = workspace.player_of(Levels - 1);
+            int mark = workspace.attract(top, label, player, attracted);
+            statistics.subgames++;
+            sub_region.clear();
+            for (const int v : region) {
+                if (workspace.mark[v] != mark) {
+                    sub_region.push_back(v);
+                }
+            }
+            solve_in<Levels - 1>(workspace, sub_region, depth + 1);
+            const int restamped = workspace.stamp(region);
+
+            opponent_won.clear();
+            for (const int v : sub_region) {
+                if (result.winner[v] != player) {
+                    opponent_won.push_back(v);
+                }
+            }
+            if (opponent_won.empty()) {
+                // The player wins everything; vertices of the top level just stay in the region
+                for (const int v : attracted) {
+                    result.winner[v] = player;
+                }
+                for (const int v : top) {
+                    if (workspace.arena.player1[v] == player) {
+                        result.strategy[v] = workspace.successor_in(v, restamped);
+                    }
+                }
+                return;
+            }
+
+            mark = workspace.attract(opponent_won, restamped, 1 - player, attracted);
+            statistics.subgames++;
+            for (const int v : attracted) {
+                result.winner[v] = 1 - player;
+            }
+            sub_region.clear();
+            for (const int v : region) {
+                if (workspace.mark[v] != mark) {
+                    sub_region.push_back(v);
+                }
+            }
+            region.swap(sub_region);
+            depth++;
+        }
+    }
+}
+
+} // namespace detail
+
+/**
+ * @brief Solve a parity game with at most Levels compressed priorities
+ * @param arena Arena from make_arena (arena.levels must be at most Levels)
+ * @return Winners, winning moves and recursion counters
+ */
+template <int Levels>
+Result solve_levels(const Arena &arena) {
+    static_assert(Levels >= 1 && Levels <= max_levels, "Levels must be between 1 and max_levels");
+    Result result;
+    result.winner.assign(arena.num_vertices, 0);
+    result.strategy.assign(arena.num_vertices, -1);
+    detail::Workspace workspace(arena, result);
+    std::vector<int> region(arena.num_vertices);
+    for (int v = 0; v < arena.num_vertices; ++v) {
+        region[v] = v;
+    }
+    detail::solve_in<Levels>(workspace, std::move(region), 0);
+    for (int v = 0; v < arena.num_vertices; ++v) {
+        if (result.winner[v] != arena.player1[v]) {
+            result.strategy[v] = -1;
+        }
+    }
+    return result;
+}
+
+/**
+ * @brief Invoke function with std::integral_constant<int, Levels> for the kernel handling levels
+ * @return False if there are more than max_levels levels
+ */
+template <typename Function>
+inline bool with_levels_for(int levels, Function &&function) {
+    if (levels <= 2) {
+        function(std::integral_constant<int, 2>{});
+        return true;
+    }
+    if (levels <= max_levels) {
+        function(std::integral_constant<int, max_levels>{});
+        return true;
+    }
+    return false;
+}
+
+/**
+ * @brief Solve a parity game with the bitboard kernel
+ *
+ * Vertices whose owner wins them but received no move from the recursion get a
+ * successor inside their winning region.
+ */
+template <typename Mask>
+Result solve_bitboard(const graphs::ParityGraph &graph) {
+    const auto arena = bitboard::make_arena<Mask>(graph);
+    std::array<int, bitboard::capacity<Mask>> strategy;
+    strategy.fill(-1);
+    Result result;
+    const Mask player0_winning_region = bitboard::solve_parity(arena, arena.player1, strategy.data(), &result.statistics);
+
+    result.winner.assign(arena.num_vertices, 0);
+    result.strategy.assign(arena.num_vertices, -1);
+    for (int v = 0; v < arena.num_vertices; ++v) {
+        const int winner = (player0_winning_region & bitboard::bit<Mask>(v)) ? 0 : 1;
+        result.winner[v] = winner;
+
+        const int owner = (arena.player1 & bitboard::bit<Mask>(v)) ? 1 : 0;
+        if (owner != winner) {
+            continue;
+        }
+        const Mask winning_region = winner == 0 ? player0_winning_region : arena.vertices & ~player0_winning_region;
+        if (strategy[v] >= 0 && (winning_region & bitboard::bit<Mask>(strategy[v]))) {
+            result.strategy[v] = strategy[v];
+        } else if (arena.successors[v] & winning_region) {
+            result.strategy[v] = bitboard::lowest_bit(arena.successors[v] & winning_region);
+        }
+    }
+    return result;
+}
+
+/**
+ * @brief Solve a parity game with the kernel specialised for its size and priorities
+ *
+ * Arenas of at most 128 vertices are solved on machine words, larger arenas whose
+ * priorities compress to at most max_levels values by solve_levels.
+ *
+ * @param graph Parity graph (max-priority, even priorities won by player 0)
+ * @param result Receives winners, winning moves and recursion counters
+ * @return False, leaving result untouched, if no specialised kernel applies
+ */
+inline bool solve(const graphs::ParityGraph &graph, Result &result) {
+    if (bitboard::with_mask_for(boost::num_vertices(graph), [&](auto mask) {
+            result = solve_bitboard<decltype(mask)>(graph);
+        })) {
+        return true;
+    }
+    return with_levels_for(graphs::priority_utilities::get_compressed_priority_count(graph), [&](auto levels) {
+        result = solve_levels<decltype(levels)::value>(make_arena(graph));
+    });
+}
+
+/**
+ * @brief Copy winners and winning moves of a kernel result into a solution
+ * @param solution Solution with set_winning_player and set_strategy (marked solved)
+ */
+template <typename SolutionType>
+void to_solution(const Result &result, SolutionType &solution) {
+    for (int v = 0; v < static_cast<int>(result.winner.size()); ++v) {
+        solution.set_winning_player(v, result.winner[v]);
+        if (result.strategy[v] >= 0) {
+            solution.set_strategy(v, result.strategy[v]);
+        }
+    }
+    solution.set_solved(true);
+}
+
+} // namespace parity_kernels
+} // namespace solvers
+} // namespace ggg
@@ -0,0 +1,755 @@
+#pragma once
+
+#include "libggg/utils/scc.hpp"
+#include <algorithm>
+#include <bit>
+#include <boost/program_options.hpp>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <map>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace ggg {
+namespace solvers {
+
+/**
+ * @brief Sweep strategy of discounted value iteration
+ */
+enum class ValueIterationMethod {
+    Worklist,    ///< The solvers' original chaotic iteration until values stop changing
+    GaussSeidel, ///< In-place sweeps in vertex order
+    Sor,         ///< Gauss-Seidel sweeps with successive over-relaxation
+    Anderson     ///< Gauss-Seidel sweeps with safeguarded Anderson mixing
+};
+
+/**
+ * @brief Parse a method name (worklist, gauss-seidel, sor, anderson)
+ * @throws std::invalid_argument for unknown names
+ */
+inline ValueIterationMethod parse_value_iteration_method(const std::string &name) {
+    if (name == "worklist") {
+        return ValueIterationMethod::Worklist;
+    }
+    if (name == "gauss-seidel") {
+        return ValueIterationMethod::GaussSeidel;
+    }
+    if (name == "sor") {
+        return ValueIterationMethod::Sor;
+    }
+    if (name == "anderson") {
+        return ValueIterationMethod::Anderson;
+    }
+    throw std::invalid_argument("Unknown value iteration method '" + name + "'");
+}
+
+inline std::string to_string(ValueIterationMethod method) {
+    switch (method) {
+    case ValueIterationMethod::Worklist:
+        return "worklist";
+    case ValueIterationMethod::GaussSeidel:
+        return "gauss-seidel";
+    case ValueIterationMethod::Sor:
+        return "sor";
+    case ValueIterationMethod::Anderson:
+        return "anderson";
+    }
+    return "worklist";
+}
+
+/**
+ * @brief Storage precision of the working values during the coarse sweeps
+ */
+enum class ValuePrecision {
+    Double,  ///< float64 throughout
+    Float,   ///< float32 coarse sweeps, then float64
+    BFloat16 ///< bfloat16 coarse sweeps (8-bit mantissa), then float64
+};
+
+/**
+ * @brief Parse a precision name (double, float, bfloat16)
+ * @throws std::invalid_argument for unknown names
+ */
+inline ValuePrecision parse_value_precision(const std::string &name) {
+    if (name == "double") {
+        return ValuePrecision::Double;
+    }
+    if (name == "float") {
+        return ValuePrecision::Float;
+    }
+    if (name == "bfloat16") {
+        return ValuePrecision::BFloat16;
+    }
+    throw std::invalid_argument("Unknown value precision '" + name + "'");
+}
+
+inline std::string to_string(ValuePrecision precision) {
+    switch (precision) {
+    case ValuePrecision::Double:
+        return "double";
+    case ValuePrecision::Float:
+        return "float";
+    case ValuePrecision::BFloat16:
+        return "bfloat16";
+    }
+    return "double";
+}
+
+/**
+ * @brief Parameters of discounted value iteration
+ */
+struct ValueIterationOptions {
+    ValueIterationMethod method = ValueIterationMethod::Worklist;
+    double tolerance = 1e-6; ///< Guaranteed bound on the distance of every value to the fixpoint
+    double omega = 1.5;      ///< Initial relaxation factor of SOR
+    int anderson_depth = 5;  ///< Number of previous iterates mixed by Anderson acceleration
+    long max_sweeps = 1000000; ///< Sweeps before giving up
+    bool topological = false; ///< Solve strongly connected components one at a time, sinks first
+    ValuePrecision precision = ValuePrecision::Double; ///< Storage of the values during the coarse sweeps
+};
+
+/**
+ * @brief Register the value iteration options of a solver command line
+ */
+inline void add_value_iteration_options(boost::program_options::options_description &desc) {
+    namespace po = boost::program_options;
+    desc.add_options()("method", po::value<std::string>()->default_value("worklist"),
+                       "Value iteration method (worklist, gauss-seidel, sor, anderson)");
+    desc.add_options()("tolerance", po::value<double>()->default_value(1e-6),
+                       "Stop once every value is provably within this distance of the fixpoint (not for worklist)");
+    desc.add_options()("omega", po::value<double>()->default_value(1.5), "Initial over-relaxation factor of sor");
+    desc.add_options()("anderson-depth", po::value<int>()->default_value(5), "Iterates mixed by anderson");
+    desc.add_options()("precision", po::value<std::string>()->default_value("double"),
+                       "Value storage of the coarse sweeps before the float64 polish (double, float, bfloat16; not for worklist)");
+    desc.add_options()("topological", "Iterate each strongly connected component to convergence, sinks first (not for worklist)");
+}
+
+/**
+ * @brief Read the options registered by add_value_iteration_options
+ * @throws std::invalid_argument for an unknown method or out-of-range parameters
+ */
+inline ValueIterationOptions value_iteration_options(const boost::program_options::variables_map &vm) {
+    ValueIterationOptions options;
+    options.method = parse_value_iteration_method(vm["method"].as<std::string>());
+    options.tolerance = vm["tolerance"].as<double>();
+    options.omega = vm["omega"].as<double>();
+    options.anderson_depth = vm["anderson-depth"].as<int>();
+    options.topological = vm.count("topological") > 0;
+    options.precision = parse_value_precision(vm["precision"].as<std::string>());
+    if (options.tolerance <= 0.0) {
+        throw std::invalid_argument("--tolerance must be positive");
+    }
+    if (options.omega < 1.0 || options.omega >= 2.0) {
+        throw std::invalid_argument("--omega must be in [1, 2)");
+    }
+    if (options.anderson_depth < 1) {
+        throw std::invalid_argument("--anderson-depth must be at least 1");
+    }
+    if (options.topological && options.method == ValueIterationMethod::Worklist) {
+        throw std::invalid_argument("--topological needs a sweep method (gauss-seidel, sor, anderson)");
+    }
+    if (options.precision != ValuePrecision::Double && options.method == ValueIterationMethod::Worklist) {
+        throw std::invalid_argument("--precision needs a sweep method (gauss-seidel, sor, anderson)");
+    }
+    return options;
+}
+
+/**
+ * @brief Work done by one value iteration run
+ */
+struct ValueIterationStatistics {
+    long sweeps = 0;             ///< Bellman sweeps over all vertices or one component (worklist: 0)
+    long updates = 0;            ///< Single-vertex Bellman evaluations
+    long coarse_sweeps = 0;      ///< Sweeps on reduced-precision values (included in sweeps)
+    long accepted_mixes = 0;     ///< Anderson steps that passed the safeguard
+    long rejected_mixes = 0;     ///< Anderson steps replaced by a plain sweep
+    double omega = 1.0;          ///< Final SOR relaxation factor
+    long components = 0;         ///< Strongly connected components (topological only)
+    long trivial_components = 0; ///< Components solved by a single evaluation
+    double residual = 0.0;       ///< Final residual: change of the last sweep, or the largest Bellman residual (topological)
+    double error_bound = 0.0;    ///< residual / (1 - discount), a bound on the distance to the fixpoint
+    double time_ms = 0.0;        ///< Time spent iterating
+    bool converged = true;
+
+    /**
+     * @brief Statistics as name/value strings, e.g. for the solver command line
+     */
+    std::map<std::string, std::string> to_map(ValueIterationMethod method, ValuePrecision precision = ValuePrecision::Double) const {
+        const auto format = [](double x) {
+            std::ostringstream out;
+            out << x;
+            return out.str();
+        };
+        std::map<std::string, std::string> stats;
+        stats["method"] = to_string(method);
+        stats["sweeps"] = std::to_string(sweeps);
+        stats["updates"] = std::to_string(updates);
+        stats["iteration_time_ms"] = format(time_ms);
+        if (method != ValueIterationMethod::Worklist) {
+            stats["residual"] = format(residual);
+            stats["error_bound"] = format(error_bound);
+        }
+        if (precision != ValuePrecision::Double) {
+            stats["precision"] = to_string(precision);
+            stats["coarse_sweeps"] = std::to_string(coarse_sweeps);
+        }
+        if (components > 0) {
+            stats["components"] = std::to_string(components);
+            stats["trivial_components"] = std::to_string(trivial_components);
+        }
+        if (method == ValueIterationMethod::Sor) {
+            stats["omega"] = format(omega);
+        }
+        if (method == ValueIterationMethod::Anderson) {
+            stats["accepted_mixes"] = std::to_string(accepted_mixes);
+            stats["rejected_mixes"] = std::to_string(rejected_mixes);
+        }
+        return stats;
+    }
+};
+
+/**
+ * @brief bfloat16 number: the upper half of a float32, rounded to nearest even
+ */
+struct BFloat16 {
+    std::uint16_t bits = 0;
+
+    BFloat16() = default;
+    BFloat16(double value) {
+        const auto word = std::bit_cast<std::uint32_t>(static_cast<float>(value));
+        bits = static_cast<std::uint16_t>((word + 0x7FFF + ((word >> 16) & 1)) >> 16);
+    }
+    operator double() const { return std::bit_cast<float>(static_cast<std::uint32_t>(bits) << 16); }
+};
+
+/**
+ * @brief Compressed Bellman operator of a discounted game
+ *
+ * Vertex v picks one of its choices [choice_offsets[v], choice_offsets[v + 1]); choice c
+ * is worth constant[c] + sum of coefficient[t] * value[target[t]] over its terms
+ * [term_offsets[c], term_offsets[c + 1]). Player 0 maximises and player 1 minimises.
+ * Vertices without choices keep their value. The coefficients of every choice sum to at
+ * most discount < 1, so the operator is a discount-contraction in the maximum norm.
+ *
+ * A choice's terms on its own vertex are solved away when the vertex is closed: with self
+ * coefficient s < 1 the choice is worth (constant + other terms) / (1 - s) at the fixpoint.
+ * The optimum over such choices has the same fixpoint and contracts at least as fast.
+ */
+struct BellmanSystem {
+    int num_vertices = 0;
+    double discount = 0.0;            ///< Largest total coefficient of a choice
+    std::vector<int> player;          ///< Owner of every vertex
+    std::vector<double> vertex_discount; ///< Largest total coefficient of each vertex's choices
+    std::vector<int> choice_offsets;  ///< Size num_vertices + 1
+    std::vector<int> choice_successor; ///< Successor chosen by every choice (its strategy)
+    std::vector<double> constant;
+    std::vector<int> term_offsets;    ///< Size choices + 1
+    std::vector<int> target;
+    std::vector<double> coefficient;
+
+    explicit BellmanSystem(int n = 0) : num_vertices(n), player(n, 0), choice_offsets(1, 0), term_offsets(1, 0) {}
+
+    /**
+     * @brief Start a choice of the current last vertex; add its terms with add_term
+     */
+    void add_choice(int successor, double value) {
+        choice_successor.push_back(successor);
+        constant.push_back(value);
+        term_offsets.push_back(term_offsets.back());
+    }
+
+    void add_term(int vertex, double factor) {
+        target.push_back(vertex);
+        coefficient.push_back(factor);
+        term_offsets.back()++;
+    }
+
+    /**
+     * @brief Close the choices of the next vertex, solving away its self terms
+     */
+    void end_vertex() {
+        const int v = static_cast<int>(choice_offsets.size()) - 1;
+        const int c = static_cast<int>(choice_successor.size());
+        double total = 0.0;
+        int write = term_offsets[choice_offsets.back()];
+        for (int i = choice_offsets.back(); i < c; ++i) {
+            double self = 0.0;
+            for (int t = term_offsets[i]; t < term_offsets[i + 1]; ++t) {
+                if (target[t] == v) {
+                    self += coefficient[t];
+                }
+            }
+            const int first = write;
+            double sum = 0.0;
+            for (int t = term_offsets[i]; t < term_offsets[i + 1]; ++t) {
+                if (target[t] != v) {
+                    target[write] = target[t];
+                    coefficient[write] = coefficient[t] / (1.0 - self);
+                    sum += std::abs(coefficient[write]);
+                    write++;
+                }
+            }
+            constant[i] /= 1.0 - self;
+            term_offsets[i] = first;
+            total = std::max(total, sum);
+        }
+        term_offsets[c] = write;
+        target.resize(write);
+        coefficient.resize(write);
+        vertex_discount.push_back(total);
+        discount = std::max(discount, total);
+        choice_offsets.push_back(c);
+    }
+
+    /**
+     * @brief Bellman update of one vertex, computed in float64; returns its best choice (-1 without choices)
+     * @param values Values of every vertex, in any storage convertible to double
+     */
+    template <typename Values>
+    int best_choice(int v, const Values &values, double &best) const {
+        int best_index = -1;
+        for (int c = choice_offsets[v]; c < choice_offsets[v + 1]; ++c) {
+            double sum = 0.0;
+            for (int t = term_offsets[c]; t < term_offsets[c + 1]; ++t) {
+                sum += coefficient[t] * static_cast<double>(values[target[t]]);
+            }
+            sum += constant[c];
+            if (best_index == -1 || (player[v] == 0 && sum > best) || (player[v] == 1 && sum < best)) {
+                best_index = c;
+                best = sum;
+            }
+        }
+        return best_index;
+    }
+};
+
+namespace detail {
+
+/**
+ * @brief One in-place Gauss-Seidel sweep over order, value v moved omega[v] times its Bellman change
+ * @param omega Relaxation factor of every vertex (empty: 1 everywhere)
+ * @return Largest absolute Bellman change seen during the sweep
+ */
+inline double bellman_sweep(const BellmanSystem &system, std::vector<double> &values, const std::vector<double> &omega,
+                            const std::vector<int> &order) {
+    double change = 0.0;
+    for (const int v : order) {
+        double best = 0.0;
+        if (system.best_choice(v, values, best) < 0) {
+            continue;
+        }
+        const double delta = best - values[v];
+        change = std::max(change, std::abs(delta));
+        values[v] += omega.empty() ? delta : omega[v] * delta;
+    }
+    return change;
+}
+
+/**
+ * @brief Largest absolute Bellman residual |T(values)_v - values_v| over order, without updating
+ */
+inline double bellman_residual(const BellmanSystem &system, const std::vector<double> &values, const std::vector<int> &order) {
+    double residual = 0.0;
+    for (const int v : order) {
+        double best = 0.0;
+        if (system.best_choice(v, values, best) >= 0) {
+            residual = std::max(residual, std::abs(best - values[v]));
+        }
+    }
+    return residual;
+}
+
+/**
+ * @brief Solve the small symmetric system matrix * x = rhs by Gaussian elimination with pivoting
+ * @return false if the system is singular
+ */
+inline bool solve_dense(std::vector<std::vector<double>> matrix, std::vector<double> rhs, std::vector<double> &x) {
+    const int m = static_cast<int>(rhs.size());
+    for (int col = 0; col < m; ++col) {
+        int pivot = col;
+        for (int row = col + 1; row < m; ++row) {
+            if (std::abs(matrix[row][col]) > std::abs(matrix[pivot][col])) {
+                pivot = row;
+            }
+        }
+        if (std::abs(matrix[pivot][col]) < 1e-300) {
+            return false;
+        }
+        std::swap(matrix[col], matrix[pivot]);
+        std::swap(rhs[col], rhs[pivot]);
+        for (int row = col + 1; row < m; ++row) {
+            const double factor = matrix[row][col] / matrix[col][col];
+            for (int k = col; k < m; ++k) {
+                matrix[row][k] -= factor * matrix[col][k];
+            }
+            rhs[row] -= factor * rhs[col];
+        }
+    }
+    x.assign(m, 0.0);
+    for (int row = m - 1; row >= 0; --row) {
+        double sum = rhs[row];
+        for (int k = row + 1; k < m; ++k) {
+            sum -= matrix[row][k] * x[k];
+        }
+        x[row] = sum / matrix[row][row];
+    }
+    return true;
+}
+
+/**
+ * @brief Iterate the values of the vertices in order until a plain sweep changes none by more than threshold
+ *
+ * Values outside order are read but never written.
+ * @return Change of the last plain sweep
+ */
+inline double iterate_block(const BellmanSystem &system, const ValueIterationOptions &options, std::vector<double> &values,
+                            const std::vector<int> &order, double threshold, ValueIterationStatistics &statistics) {
+    const int k = static_cast<int>(order.size());
+    const std::vector<double> plain;
+    const auto sweep = [&](std::vector<double> &x, const std::vector<double> &omega) {
+        statistics.sweeps++;
+        statistics.updates += k;
+        return bellman_sweep(system, x, omega, order);
+    };
+
+    if (options.method != ValueIterationMethod::Anderson) {
+        std::vector<double> omega;
+        if (options.method == ValueIterationMethod::Sor) {
+            omega.assign(system.num_vertices, 1.0);
+            for (const int v : order) {
+                const double bound = 2.0 / (1.0 + system.vertex_discount[v]) - 1.0;
+                omega[v] = 1.0 + std::min(options.omega - 1.0, 0.9 * bound);
+                statistics.omega = std::max(statistics.omega, omega[v]);
+            }
+        }
+        double previous = std::numeric_limits<double>::infinity();
+        double change = 0.0;
+        while (statistics.sweeps < options.max_sweeps) {
+            change = sweep(values, omega);
+            if (!omega.empty() && change > system.discount * previous) {
+                // Slower than the rate guaranteed without relaxation: halve the over-relaxation
+                bool relaxed = false;
+                for (const int v : order) {
+                    omega[v] = 1.0 + (omega[v] - 1.0) / 2.0;
+                    relaxed = relaxed || omega[v] > 1.0 + 1e-4;
+                }
+                if (!relaxed) {
+                    omega.clear();
+                }
+            }
+            previous = change;
+            if (change <= threshold) {
+                // A relaxed sweep's change is not the plain residual: confirm with a plain sweep
+                if (omega.empty() || (change = sweep(values, plain)) <= threshold) {
+                    break;
+                }
+            }
+        }
+        return change;
+    }
+
+    // Anderson mixing on the block's values; G sweeps the block in place
+    const auto gather = [&](std::vector<double> &block) {
+        block.resize(k);
+        for (int i = 0; i < k; ++i) {
+            block[i] = values[order[i]];
+        }
+    };
+    const auto scatter = [&](const std::vector<double> &block) {
+        for (int i = 0; i < k; ++i) {
+            values[order[i]] = block[i];
+        }
+    };
+    const auto map = [&](const std::vector<double> &x, std::vector<double> &mapped) {
+        scatter(x);
+        const double change = sweep(values, plain);
+        gather(mapped);
+        return change;
+    };
+
+    const int depth = options.anderson_depth;
+    std::vector<double> current;
+    gather(current);
+    std::vector<double> mapped;
+    double residual = map(current, mapped);
+    std::vector<std::vector<double>> mapped_history{mapped};
+    std::vector<std::vector<double>> residual_history;
+    std::vector<double> f(k);
+    for (int i = 0; i < k; ++i) {
+        f[i] = mapped[i] - current[i];
+    }
+    residual_history.push_back(f);
+
+    int cooldown = 0;
+    int backoff = 1;
+    while (residual > threshold && statistics.sweeps < options.max_sweeps) {
+        std::vector<double> candidate = mapped;
+        const int m = cooldown > 0 ? 0 : static_cast<int>(residual_history.size()) - 1;
+        if (m > 0) {
+            // Minimise |f_k - sum gamma_j (f_{j+1} - f_j)| over the stored differences
+            std::vector<std::vector<double>> df(m, std::vector<double>(k));
+            for (int j = 0; j < m; ++j) {
+                for (int i = 0; i < k; ++i) {
+                    df[j][i] = residual_history[j + 1][i] - residual_history[j][i];
+                }
+            }
+            std::vector<std::vector<double>> normal(m, std::vector<double>(m, 0.0));
+            std::vector<double> rhs(m, 0.0);
+            double trace = 0.0;
+            for (int a = 0; a < m; ++a) {
+                for (int b = a; b < m; ++b) {
+                    double dot = 0.0;
+                    for (int i = 0; i < k; ++i) {
+                        dot += df[a][i] * df[b][i];
+                    }
+                    normal[a][b] = normal[b][a] = dot;
+                }
+                for (int i = 0; i < k; ++i) {
+                    rhs[a] += df[a][i] * residual_history.back()[i];
+                }
+                trace += normal[a][a];
+            }
+            for (int a = 0; a < m; ++a) {
+                normal[a][a] += 1e-10 * trace + 1e-300;
+            }
+            std::vector<double> gamma;
+            if (solve_dense(normal, rhs, gamma)) {
+                for (int j = 0; j < m; ++j) {
+                    for (int i = 0; i < k; ++i) {
+                        candidate[i] -= gamma[j] * (mapped_history[j + 1][i] - mapped_history[j][i]);
+                    }
+                }
+            }
+        }
+
+        // Safeguard: the mixed iterate must shrink the residual
+        std::vector<double> candidate_mapped;
+        const double candidate_residual = m > 0 ? map(candidate, candidate_mapped) : residual + 1.0;
+        if (m > 0 && candidate_residual < residual) {
+            statistics.accepted_mixes++;
+            backoff = 1;
+            current = std::move(candidate);
+            mapped = std::move(candidate_mapped);
+            residual = candidate_residual;
+        } else {
+            if (m > 0) {
+                // Mixing stalls where strategies switch: take more plain sweeps after each failure
+                statistics.rejected_mixes++;
+                cooldown = backoff;
+                backoff = std::min(2 * backoff, 64);
+            } else if (cooldown > 0) {
+                cooldown--;
+            }
+            current = mapped;
+            residual = map(current, mapped);
+        }
+        for (int i = 0; i < k; ++i) {
+            f[i] = mapped[i] - current[i];
+        }
+        mapped_history.push_back(mapped);
+        residual_history.push_back(f);
+        if (static_cast<int>(residual_history.size()) > depth + 1) {
+            mapped_history.erase(mapped_history.begin());
+            residual_history.erase(residual_history.begin());
+        }
+    }
+    scatter(mapped);
+    return residual;
+}
+
+/**
+ * @brief Coarse Gauss-Seidel sweeps on values stored in Storage, until rounding dominates
+ *
+ * Bellman updates are computed in float64 from the coarse values and rounded on store, so
+ * successor reads move half (float) or a quarter (bfloat16) of the bytes. Every 16 sweeps,
+ * or once the change is within a few roundings of the values, a float64 sweep corrects the
+ * coarse iterate; when that sweep's change is itself at the rounding level the coarse
+ * precision is exhausted and the float64 values are left for the polish.
+ */
+template <typename Storage>
+void coarse_block(const BellmanSystem &system, const ValueIterationOptions &options, std::vector<double> &values,
+                  std::vector<Storage> &coarse, const std::vector<int> &order, double threshold,
+                  ValueIterationStatistics &statistics) {
+    constexpr double unit_roundoff = std::is_same_v<Storage, float> ? 0x1p-24 : 0x1p-8;
+    constexpr int refresh_interval = 16;
+    const long k = static_cast<long>(order.size());
+    for (const int v : order) {
+        coarse[v] = Storage(values[v]);
+    }
+    double magnitude = 0.0;
+    int since_refresh = 0;
+    while (statistics.sweeps < options.max_sweeps) {
+        double change = 0.0;
+        for (const int v : order) {
+            double best = 0.0;
+            if (system.best_choice(v, coarse, best) < 0) {
+                continue;
+            }
+            change = std::max(change, std::abs(best - static_cast<double>(coarse[v])));
+            magnitude = std::max(magnitude, std::abs(best));
+            coarse[v] = Storage(best);
+        }
+        statistics.sweeps++;
+        statistics.coarse_sweeps++;
+        statistics.updates += k;
+        const double floor = 8.0 * unit_roundoff * magnitude;
+        if (++since_refresh < refresh_interval && change > floor && change > threshold) {
+            continue;
+        }
+
+        // float64 residual-correction sweep from the coarse iterate
+        since_refresh = 0;
+        for (const int v : order) {
+            values[v] = static_cast<double>(coarse[v]);
+        }
+        const double exact = bellman_sweep(system, values, {}, order);
+        statistics.sweeps++;
+        statistics.updates += k;
+        if (exact <= floor || exact <= threshold) {
+            return;
+        }
+        for (const int v : order) {
+            coarse[v] = Storage(values[v]);
+        }
+    }
+}
+
+/**
+ * @brief iterate_values with coarse sweeps in Storage before each float64 iteration (none for double)
+ */
+template <typename Storage>
+ValueIterationStatistics iterate_values_in(const BellmanSystem &system, const ValueIterationOptions &options,
+                                           std::vector<double> &values) {
+    constexpr bool reduced = !std::is_same_v<Storage, double>;
+    ValueIterationStatistics statistics;
+    const auto start = std::chrono::steady_clock::now();
+    const int n = system.num_vertices;
+    const double threshold = options.tolerance * (1.0 - system.discount);
+    std::vector<Storage> coarse;
+    if constexpr (reduced) {
+        coarse.assign(values.begin(), values.end());
+    }
+
+    if (!options.topological) {
+        std::vector<int> order(n);
+        for (int v = 0; v < n; ++v) {
+            order[v] = v;
+        }
+        if constexpr (reduced) {
+            coarse_block(system, options, values, coarse, order, threshold, statistics);
+        }
+        statistics.residual = iterate_block(system, options, values, order, threshold, statistics);
+    } else {
+        const auto [component, count] = utils::strongly_connected_components(n, [&](int v, auto &&visit) {
+            for (int c = system.choice_offsets[v]; c < system.choice_offsets[v + 1]; ++c) {
+                for (int t = system.term_offsets[c]; t < system.term_offsets[c + 1]; ++t) {
+                    visit(system.target[t]);
+                }
+            }
+        });
+        std::vector<std::vector<int>> members(count);
+        for (int v = 0; v < n; ++v) {
+            members[component[v]].push_back(v);
+        }
+        statistics.components = count;
+        for (const auto &order : members) {
+            if (order.size() == 1) {
+                // Its successors are final and it does not depend on itself
+                double best = 0.0;
+                if (system.best_choice(order[0], values, best) >= 0) {
+                    values[order[0]] = best;
+                }
+                if constexpr (reduced) {
+                    coarse[order[0]] = Storage(values[order[0]]);
+                }
+                statistics.trivial_components++;
+                statistics.updates++;
+                continue;
+            }
+            if constexpr (reduced) {
+                coarse_block(system, options, values, coarse, order, threshold, statistics);
+            }
+            double block_threshold = threshold;
+            double residual = std::numeric_limits<double>::infinity();
+            while (statistics.sweeps < options.max_sweeps) {
+                iterate_block(system, options, values, order, block_threshold, statistics);
+                residual = bellman_residual(system, values, order);
+                statistics.updates += static_cast<long>(order.size());
+                if (residual <= threshold) {
+                    break;
+                }
+                block_threshold /= 2.0;
+            }
+            if constexpr (reduced) {
+                for (const int v : order) {
+                    coarse[v] = Storage(values[v]);
+                }
+            }
+            statistics.residual = std::max(statistics.residual, residual);
+        }
+    }
+
+    statistics.converged = statistics.residual <= threshold;
+    statistics.error_bound = statistics.residual / (1.0 - system.discount);
+    statistics.time_ms = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+    return statistics;
+}
+
+} // namespace detail
+
+/**
+ * @brief Iterate the Bellman operator of a discounted game to a guaranteed tolerance
+ *
+ * The plain Gauss-Seidel sweep G is a discount-contraction with the game's values as
+ * fixpoint, so a sweep that changes no value by more than r leaves every value within
+ * r / (1 - discount) of the fixpoint. All methods stop on that bound, checked on a plain
+ * sweep, so the result is sound whatever the acceleration did before.
+ *
+ * - GaussSeidel repeats G.
+ * - Sor moves every value omega times its Bellman change. Vertex v is relaxed by at most
+ *   1 + 0.9 (2 / (1 + d) - 1), d its largest total coefficient: moving by w times a
+ *   d-contractive change is a (w - 1 + w d)-contraction, which stays below 1 there, so
+ *   over-relaxed sweeps still converge on max/min operators. With discounts near 1 the
+ *   admissible relaxation is small.
+ * - Anderson extrapolates from the last anderson_depth iterates of G by least squares on
+ *   their residuals. A mixed iterate is kept only if its residual is below the current
+ *   one; otherwise the plain sweep is taken and mixing pauses for a number of sweeps that
+ *   doubles with every consecutive failure.
+ *
+ * With options.topological the vertices are split into strongly connected components of
+ * the dependency graph and solved sinks first, each with the chosen method while the
+ * values it depends on are final. Components of one vertex (self terms are solved away)
+ * take a single evaluation. Since every vertex's Bellman residual only involves final
+ * values, each component is iterated until its residual is below the threshold, and the
+ * largest residual bounds the error as above.
+ *
+ * With a reduced options.precision every component (or the whole graph) first runs coarse
+ * Gauss-Seidel sweeps on float32 or bfloat16 copies of the values (see coarse_block), and
+ * the chosen method then polishes in float64, so the tolerance is met as before.
+ *
+ * @param system Bellman operator
+ * @param options Method and tolerance (Worklist is treated as GaussSeidel)
+ * @param values Start values, overwritten by the result
+ * @return Work done and the final error bound
+ */
+inline ValueIterationStatistics iterate_values(const BellmanSystem &system, const ValueIterationOptions &options,
+                                               std::vector<double> &values) {
+    switch (options.precision) {
+    case ValuePrecision::Float:
+        return detail::iterate_values_in<float>(system, options, values);
+    case ValuePrecision::BFloat16:
+        return detail::iterate_values_in<BFloat16>(system, options, values);
+    case ValuePrecision::Double:
+        break;
+    }
+    return detail::iterate_values_in<double>(system, options, values);
+}
+
+} // namespace solvers
+} // namespace ggg
@@ -0,0 +1,175 @@
+#pragma once
+
+#include "libggg/solvers/value_iteration.hpp"
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstring>
+#include <vector>
+
+namespace ggg {
+namespace solvers {
+namespace value_lanes {
+
+/**
+ * @brief Ownership samples iterated together, one double lane each
+ */
+inline constexpr int lane_count = 8;
+
+/**
+ * @brief Bit l of a vertex's owner byte says lane l gives the vertex to player 1 (minimiser)
+ */
+using Owners = std::vector<std::uint8_t>;
+
+namespace detail {
+
+/**
+ * @brief Width lanes of one vertex (an SSE2, AVX2 or AVX-512 register) and a select mask
+ *
+ * Their alignment depends on the instruction set a function is compiled for, so lanes
+ * are stored as plain doubles and copied in and out with memcpy.
+ */
+template <int Width>
+struct Vector;
+
+template <>
+struct Vector<2> {
+    typedef double Values __attribute__((vector_size(16)));
+    typedef std::int64_t Mask __attribute__((vector_size(16)));
+};
+
+template <>
+struct Vector<4> {
+    typedef double Values __attribute__((vector_size(32)));
+    typedef std::int64_t Mask __attribute__((vector_size(32)));
+};
+
+template <>
+struct Vector<8> {
+    typedef double Values __attribute__((vector_size(64)));
+    typedef std::int64_t Mask __attribute__((vector_size(64)));
+};
+
+/**
+ * @brief iterate computing Width lanes per vector operation
+ *
+ * Inlined into functions compiled for a specific instruction set; the maximum and the
+ * minimum over the choices are blended per lane by the owner byte, so ownership costs
+ * no branches.
+ */
+template <int Width>
+[[gnu::always_inline]] inline ValueIterationStatistics iterate_lanes(const BellmanSystem &system, const Owners &minimiser,
+                                                                     const ValueIterationOptions &options, std::vector<double> &values) {
+    using Values = typename Vector<Width>::Values;
+    using Mask = typename Vector<Width>::Mask;
+    ValueIterationStatistics statistics;
+    const auto start = std::chrono::steady_clock::now();
+    const double threshold = options.tolerance * (1.0 - system.discount);
+    Mask lane_bit;
+    for (int lane = 0; lane < Width; ++lane) {
+        lane_bit[lane] = std::int64_t(1) << lane;
+    }
+    if (values.size() != static_cast<std::size_t>(system.num_vertices) * lane_count) {
+        values.assign(static_cast<std::size_t>(system.num_vertices) * lane_count, 0.0);
+    }
+    while (statistics.sweeps < options.max_sweeps) {
+        // Gauss-Seidel sweep of all lanes, Width at a time
+        Values change = {};
+        for (int v = 0; v < system.num_vertices; ++v) {
+            const int first = system.choice_offsets[v];
+            const int last = system.choice_offsets[v + 1];
+            if (first == last) {
+                continue;
+            }
+            for (int offset = 0; offset < lane_count; offset += Width) {
+                Values best_max = {};
+                Values best_min = {};
+                for (int c = first; c < last; ++c) {
+                    Values q = Values{} + system.constant[c];
+                    for (int t = system.term_offsets[c]; t < system.term_offsets[c + 1]; ++t) {
+                        Values successor;
+                        std::memcpy(&successor, &values[static_cast<std::size_t>(system.target[t]) * lane_count + offset], sizeof(Values));
+                        q += system.coefficient[t] * successor;
+                    }
+                    if (c == first) {
+                        best_max = best_min = q;
+                    } else {
+                        best_max = q > best_max ? q : best_max;
+                        best_min = q < best_min ? q : best_min;
+                    }
+                }
+                const Mask owned = (Mask{} + (minimiser[v] >> offset)) & lane_bit;
+                const Values updated = owned != 0 ? best_min : best_max;
+                double *slot = &values[static_cast<std::size_t>(v) * lane_count + offset];
+                Values current;
+                std::memcpy(&current, slot, sizeof(Values));
+                const Values delta = updated - current;
+                const Values magnitude = delta < 0 ? -delta : delta;
+                change = magnitude > change ? magnitude : change;
+                std::memcpy(slot, &updated, sizeof(Values));
+            }
+        }
+        statistics.sweeps++;
+        statistics.updates += static_cast<long>(system.num_vertices) * lane_count;
+        statistics.residual = 0.0;
+        for (int lane = 0; lane < Width; ++lane) {
+            statistics.residual = std::max(statistics.residual, change[lane]);
+        }
+        if (statistics.residual <= threshold) {
+            break;
+        }
+    }
+    statistics.converged = statistics.residual <= threshold;
+    statistics.error_bound = statistics.residual / (1.0 - system.discount);
+    statistics.time_ms = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+    return statistics;
+}
+
+#if defined(__x86_64__) && defined(__GNUC__)
+__attribute__((target("avx512f"))) inline ValueIterationStatistics iterate_avx512(const BellmanSystem &system, const Owners &minimiser,
+                                                                                  const ValueIterationOptions &options,
+                                                                                  std::vector<double> &values) {
+    return iterate_lanes<8>(system, minimiser, options, values);
+}
+
+__attribute__((target("avx2"))) inline ValueIterationStatistics iterate_avx2(const BellmanSystem &system, const Owners &minimiser,
+                                                                             const ValueIterationOptions &options,
+                                                                             std::vector<double> &values) {
+    return iterate_lanes<4>(system, minimiser, options, values);
+}
+#endif
+
+} // namespace detail
+
+/**
+ * @brief Value iteration of up to lane_count ownership samples of one system
+ *
+ * Lanes share the choices, coefficients and sweep order and differ only in which vertices
+ * maximise. Sweeps continue until the Gauss-Seidel change of every lane is at most
+ * options.tolerance * (1 - discount), which bounds each lane's error by the tolerance as
+ * in iterate_values; lanes that converge early keep sweeping with the others. The sweeps
+ * run 8 lanes per AVX-512 instruction or 4 per AVX2 instruction, whichever the CPU
+ * supports, and baseline vector code elsewhere.
+ *
+ * @param system Compressed Bellman equations (system.player is ignored)
+ * @param minimiser Owner byte of every vertex
+ * @param options Tolerance and sweep limit (the method is always Gauss-Seidel)
+ * @param values Start values, lane_count per vertex (resized and zeroed if the size is wrong); the lanes' values on return
+ * @return Statistics; residual is the largest final change over the lanes
+ */
+inline ValueIterationStatistics iterate(const BellmanSystem &system, const Owners &minimiser, const ValueIterationOptions &options,
+                                        std::vector<double> &values) {
+#if defined(__x86_64__) && defined(__GNUC__)
+    if (__builtin_cpu_supports("avx512f")) {
+        return detail::iterate_avx512(system, minimiser, options, values);
+    }
+    if (__builtin_cpu_supports("avx2")) {
+        return detail::iterate_avx2(system, minimiser, options, values);
+    }
+#endif
+    return detail::iterate_lanes<2>(system, minimiser, options, values);
+}
+
+} // namespace value_lanes
+} // namespace solvers
+} // namespace ggg
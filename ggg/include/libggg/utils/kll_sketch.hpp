@@ -0,0 +1,228 @@
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <utility>
+#include <vector>
+
+namespace ggg {
+namespace utils {
+
+/**
+ * @brief Mergeable streaming quantile sketch (KLL)
+ *
+ * Keeps a stack of compactors: level h holds items of weight 2^h. When the sketch
+ * exceeds its capacity, the lowest full level is sorted and every other item (starting
+ * at an alternating offset) is promoted to the next level with double weight. Level
+ * capacities shrink geometrically towards the bottom, so memory stays O(k log(n / k))
+ * and the rank error is about 1.7 / k with high probability.
+ *
+ * Count, sum, minimum and maximum are tracked exactly. Sketches built independently
+ * (e.g. one per thread) are combined with merge().
+ */
+class KllSketch {
+  public:
+    /**
+     * @brief Create an empty sketch
+     * @param k Accuracy parameter (capacity of the top compactor)
+     */
+    explicit KllSketch(int k = 200) : k_(std::max(k, 8)) {
+        levels_.emplace_back();
+    }
+
+    /**
+     * @brief Add one value
+     */
+    void update(double value) {
+        levels_[0].push_back(value);
+        count_++;
+        sum_ += value;
+        min_ = std::min(min_, value);
+        max_ = std::max(max_, value);
+        if (++size_ > capacity_total()) {
+            compress();
+        }
+    }
+
+    /**
+     * @brief Absorb another sketch built with any k
+     */
+    void merge(const KllSketch &other) {
+        while (levels_.size() < other.levels_.size()) {
+            levels_.emplace_back();
+        }
+        for (size_t h = 0; h < other.levels_.size(); ++h) {
+            levels_[h].insert(levels_[h].end(), other.levels_[h].begin(), other.levels_[h].end());
+        }
+        size_ += other.size_;
+        count_ += other.count_;
+        sum_ += other.sum_;
+        min_ = std::min(min_, other.min_);
+        max_ = std::max(max_, other.max_);
+        while (size_ > capacity_total()) {
+            compress();
+        }
+    }
+
+    /**
+     * @brief Number of values added
+     */
+    std::uint64_t count() const { return count_; }
+
+    /**
+     * @brief Exact mean of the values added (0 if empty)
+     */
+    double mean() const { return count_ == 0 ? 0.0 : sum_ / static_cast<double>(count_); }
+
+    /**
+     * @brief Smallest value added
+     */
+    double min() const { return min_; }
+
+    /**
+     * @brief Largest value added
+     */
+    double max() const { return max_; }
+
+    /**
+     * @brief Number of items retained (the memory footprint)
+     */
+    std::size_t retained() const { return size_; }
+
+    /**
+     * @brief Approximate q-quantile, q in [0, 1]
+     */
+    double quantile(double q) const {
+        if (count_ == 0) {
+            return std::numeric_limits<double>::quiet_NaN();
+        }
+        if (q <= 0.0) {
+            return min_;
+        }
+        if (q >= 1.0) {
+            return max_;
+        }
+        const auto items = weighted_items();
+        std::uint64_t total = 0;
+        for (const auto &item : items) {
+            total += item.second;
+        }
+        const double wanted = q * static_cast<double>(total);
+        std::uint64_t cumulative = 0;
+        for (const auto &[value, weight] : items) {
+            cumulative += weight;
+            if (static_cast<double>(cumulative) >= wanted) {
+                return value;
+            }
+        }
+        return max_;
+    }
+
+    /**
+     * @brief Approximate fraction of the values that are at most x
+     */
+    double rank(double x) const {
+        std::uint64_t below = 0;
+        std::uint64_t total = 0;
+        for (size_t h = 0; h < levels_.size(); ++h) {
+            for (const double value : levels_[h]) {
+                total += std::uint64_t(1) << h;
+                if (value <= x) {
+                    below += std::uint64_t(1) << h;
+                }
+            }
+        }
+        return total == 0 ? 0.0 : static_cast<double>(below) / static_cast<double>(total);
+    }
+
+    /**
+     * @brief Approximate number of values per bin
+     * @param edges Increasing bin edges; bin i is (edges[i], edges[i + 1]], the first bin also takes edges[0]
+     * @return edges.size() - 1 estimated counts
+     */
+    std::vector<double> histogram(const std::vector<double> &edges) const {
+        std::vector<double> counts;
+        for (size_t i = 0; i + 1 < edges.size(); ++i) {
+            const double low = i == 0 ? std::nextafter(edges[0], -std::numeric_limits<double>::infinity()) : edges[i];
+            counts.push_back((rank(edges[i + 1]) - rank(low)) * static_cast<double>(count_));
+        }
+        return counts;
+    }
+
+  private:
+    int k_;
+    std::vector<std::vector<double>> levels_;
+    std::size_t size_ = 0;
+    std::uint64_t count_ = 0;
+    double sum_ = 0.0;
+    double min_ = std::numeric_limits<double>::infinity();
+    double max_ = -std::numeric_limits<double>::infinity();
+    bool odd_offset_ = false;
+
+    /**
+     * @brief Capacity of level h: k at the top, shrinking by 2/3 per level below, at least 2
+     */
+    std::size_t capacity(size_t h) const {
+        const double depth = static_cast<double>(levels_.size() - 1 - h);
+        return std::max<std::size_t>(2, static_cast<std::size_t>(std::ceil(k_ * std::pow(2.0 / 3.0, depth))));
+    }
+
+    std::size_t capacity_total() const {
+        std::size_t total = 0;
+        for (size_t h = 0; h < levels_.size(); ++h) {
+            total += capacity(h);
+        }
+        return total;
+    }
+
+    /**
+     * @brief Halve the lowest full level into the next one
+     */
+    void compress() {
+        for (size_t h = 0; h < levels_.size(); ++h) {
+            if (levels_[h].size() < capacity(h)) {
+                continue;
+            }
+            if (h + 1 == levels_.size()) {
+                levels_.emplace_back();
+            }
+            auto &level = levels_[h];
+            std::sort(level.begin(), level.end());
+
+            // An odd item stays behind so that total weight is preserved
+            double kept = 0.0;
+            const bool odd = level.size() % 2 == 1;
+            if (odd) {
+                kept = level.back();
+                level.pop_back();
+            }
+            const size_t offset = odd_offset_ ? 1 : 0;
+            odd_offset_ = !odd_offset_;
+            for (size_t i = offset; i < level.size(); i += 2) {
+                levels_[h + 1].push_back(level[i]);
+            }
+            size_ -= level.size() / 2;
+            level.clear();
+            if (odd) {
+                level.push_back(kept);
+            }
+            return;
+        }
+    }
+
+    std::vector<std::pair<double, std::uint64_t>> weighted_items() const {
+        std::vector<std::pair<double, std::uint64_t>> items;
+        for (size_t h = 0; h < levels_.size(); ++h) {
+            for (const double value : levels_[h]) {
+                items.emplace_back(value, std::uint64_t(1) << h);
+            }
+        }
+        std::sort(items.begin(), items.end());
+        return items;
+    }
+};
+
+} // namespace utils
+} // namespace ggg
@@ -0,0 +1,327 @@
+#pragma once
+
+#include <bit>
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <mutex>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+namespace ggg {
+namespace utils {
+
+namespace detail {
+
+/**
+ * @brief Append an unsigned integer or double to bytes, least significant byte first
+ */
+template <typename T>
+void append_little_endian(std::vector<char> &bytes, T value) {
+    std::uint64_t bits;
+    if constexpr (std::is_same_v<T, double>) {
+        bits = std::bit_cast<std::uint64_t>(value);
+    } else {
+        bits = value;
+    }
+    for (std::size_t i = 0; i < sizeof(T); ++i) {
+        bytes.push_back(static_cast<char>((bits >> (8 * i)) & 0xff));
+    }
+}
+
+/**
+ * @brief Read an unsigned integer or double stored least significant byte first
+ */
+template <typename T>
+T load_little_endian(const unsigned char *bytes) {
+    std::uint64_t bits = 0;
+    for (std::size_t i = 0; i < sizeof(T); ++i) {
+        bits |= static_cast<std::uint64_t>(bytes[i]) << (8 * i);
+    }
+    if constexpr (std::is_same_v<T, double>) {
+        return std::bit_cast<double>(bits);
+    } else {
+        return static_cast<T>(bits);
+    }
+}
+
+} // namespace detail
+
+/**
+ * @brief Per-sample results of an ownership sampler, in column order
+ *
+ * Sample i owns bytes [i * owner_bytes, (i + 1) * owner_bytes) of owners; bit v (least
+ * significant first) is set when vertex v is owned by player 1.
+ */
+struct SampleChunk {
+    std::size_t owner_bytes = 0;        ///< ceil(num_vertices / 8)
+    std::vector<std::uint8_t> owners;   ///< Packed ownership bitstrings
+    std::vector<char> outcomes;         ///< Non-zero if player 0 wins the query vertex
+    std::vector<double> values;         ///< Query vertex values (empty if the store has none)
+    std::vector<std::uint32_t> times_us; ///< Solve time per sample in microseconds
+
+    explicit SampleChunk(std::size_t num_vertices = 0) : owner_bytes((num_vertices + 7) / 8) {}
+
+    std::size_t size() const { return outcomes.size(); }
+
+    /**
+     * @brief Start a new sample with every vertex owned by player 0; returns its owner bytes
+     */
+    std::uint8_t *add_sample(bool outcome, std::uint32_t time_us) {
+        outcomes.push_back(outcome ? 1 : 0);
+        times_us.push_back(time_us);
+        owners.resize(owners.size() + owner_bytes, 0);
+        return owners.data() + owners.size() - owner_bytes;
+    }
+
+    void clear() {
+        owners.clear();
+        outcomes.clear();
+        values.clear();
+        times_us.clear();
+    }
+};
+
+/**
+ * @brief Append-only columnar store of per-sample results
+ *
+ * A store is a directory with one file per column:
+ * - owners.bin: packed ownership bitstrings, ceil(n / 8) bytes per sample
+ * - outcome.bin: one bit per sample, least significant bit first
+ * - value.bin: float64 per sample (only for value objectives)
+ * - time_us.bin: uint32 microseconds per sample
+ * - header: "key=value" lines (format, vertices, samples, values), written on close
+ *
+ * All binary columns are little-endian whatever the host's byte order. Chunks are
+ * appended under a lock, so several sampling threads can share one writer. Failed writes
+ * and closes throw; the destructor closes silently, so call close() to see its errors.
+ */
+class SampleStoreWriter {
+  public:
+    /**
+     * @brief Create (or truncate) a store
+     * @param directory Store directory, created if missing
+     * @param num_vertices Vertices per bitstring
+     * @param with_values Whether a value column is written
+     * @throws std::runtime_error if the column files cannot be opened
+     */
+    SampleStoreWriter(const std::string &directory, std::size_t num_vertices, bool with_values)
+        : directory_(directory), num_vertices_(num_vertices), with_values_(with_values) {
+        std::filesystem::create_directories(directory_);
+        open(owners_, "owners.bin");
+        open(outcomes_, "outcome.bin");
+        open(times_, "time_us.bin");
+        if (with_values_) {
+            open(values_, "value.bin");
+        }
+    }
+
+    ~SampleStoreWriter() {
+        try {
+            close();
+        } catch (...) {
+        }
+    }
+
+    /**
+     * @brief Append a chunk of samples
+     * @throws std::runtime_error if a column cannot be written
+     */
+    void write(const SampleChunk &chunk) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        std::vector<char> bytes;
+        put(owners_, "owners.bin", reinterpret_cast<const char *>(chunk.owners.data()), chunk.owners.size());
+        for (const std::uint32_t time_us : chunk.times_us) {
+            detail::append_little_endian(bytes, time_us);
+        }
+        put(times_, "time_us.bin", bytes.data(), bytes.size());
+        if (with_values_) {
+            bytes.clear();
+            for (const double value : chunk.values) {
+                detail::append_little_endian(bytes, value);
+            }
+            put(values_, "value.bin", bytes.data(), bytes.size());
+        }
+
+        // Outcome bits continue across chunks
+        bytes.clear();
+        for (const char outcome : chunk.outcomes) {
+            pending_ |= static_cast<std::uint8_t>(outcome ? 1 : 0) << pending_bits_;
+            if (++pending_bits_ == 8) {
+                bytes.push_back(static_cast<char>(pending_));
+                pending_ = 0;
+                pending_bits_ = 0;
+            }
+        }
+        put(outcomes_, "outcome.bin", bytes.data(), bytes.size());
+        samples_ += chunk.size();
+    }
+
+    /**
+     * @brief Flush the last outcome bits and write the header; further writes are invalid
+     * @throws std::runtime_error if a column or the header cannot be written
+     */
+    void close() {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (closed_) {
+            return;
+        }
+        closed_ = true;
+        if (pending_bits_ > 0) {
+            const char last = static_cast<char>(pending_);
+            put(outcomes_, "outcome.bin", &last, 1);
+        }
+        finish(owners_, "owners.bin");
+        finish(outcomes_, "outcome.bin");
+        finish(times_, "time_us.bin");
+        if (with_values_) {
+            finish(values_, "value.bin");
+        }
+
+        std::ofstream header((std::filesystem::path(directory_) / "header").string());
+        header << "format=ggg-samples-1\n";
+        header << "vertices=" << num_vertices_ << "\n";
+        header << "samples=" << samples_ << "\n";
+        header << "values=" << (with_values_ ? 1 : 0) << "\n";
+        finish(header, "header");
+    }
+
+  private:
+    std::string directory_;
+    std::size_t num_vertices_;
+    bool with_values_;
+    std::ofstream owners_;
+    std::ofstream outcomes_;
+    std::ofstream values_;
+    std::ofstream times_;
+    std::uint8_t pending_ = 0;
+    int pending_bits_ = 0;
+    std::uint64_t samples_ = 0;
+    bool closed_ = false;
+    std::mutex mutex_;
+
+    void open(std::ofstream &file, const std::string &name) {
+        const auto path = (std::filesystem::path(directory_) / name).string();
+        file.open(path, std::ios::binary | std::ios::trunc);
+        if (!file.is_open()) {
+            throw std::runtime_error("Failed to open " + path);
+        }
+    }
+
+    void put(std::ofstream &file, const std::string &name, const char *data, std::size_t size) {
+        if (!file.write(data, static_cast<std::streamsize>(size))) {
+            throw std::runtime_error("Failed to write " + (std::filesystem::path(directory_) / name).string());
+        }
+    }
+
+    void finish(std::ofstream &file, const std::string &name) {
+        file.close();
+        if (file.fail()) {
+            throw std::runtime_error("Failed to write " + (std::filesystem::path(directory_) / name).string());
+        }
+    }
+};
+
+/**
+ * @brief Reader for stores written by SampleStoreWriter
+ *
+ * Loads every column into memory on construction.
+ */
+class SampleStoreReader {
+  public:
+    /**
+     * @brief Load a store
+     * @throws std::runtime_error if the header is missing or a column is truncated
+     */
+    explicit SampleStoreReader(const std::string &directory) {
+        const std::filesystem::path root(directory);
+        std::ifstream header((root / "header").string());
+        if (!header.is_open()) {
+            throw std::runtime_error("No sample store header in " + directory);
+        }
+        std::string line;
+        std::string format;
+        while (std::getline(header, line)) {
+            const auto equals = line.find('=');
+            if (equals == std::string::npos) {
+                continue;
+            }
+            const std::string key = line.substr(0, equals);
+            const std::string value = line.substr(equals + 1);
+            if (key == "format") {
+                format = value;
+            } else if (key == "vertices") {
+                num_vertices_ = std::stoull(value);
+            } else if (key == "samples") {
+                samples_ = std::stoull(value);
+            } else if (key == "values") {
+                with_values_ = value == "1";
+            }
+        }
+        if (format != "ggg-samples-1") {
+            throw std::runtime_error("Unsupported sample store format '" + format + "'");
+        }
+
+        owner_bytes_ = (num_vertices_ + 7) / 8;
+        read(root / "owners.bin", owners_, samples_ * owner_bytes_);
+        read(root / "outcome.bin", outcomes_, (samples_ + 7) / 8);
+        read(root / "time_us.bin", times_us_, samples_);
+        if (with_values_) {
+            read(root / "value.bin", values_, samples_);
+        }
+    }
+
+    std::size_t size() const { return samples_; }
+    std::size_t num_vertices() const { return num_vertices_; }
+    bool has_values() const { return with_values_; }
+
+    /**
+     * @brief Owner (0 or 1) of a vertex in a sample
+     */
+    int owner(std::size_t sample, std::size_t vertex) const {
+        return (owners_[sample * owner_bytes_ + vertex / 8] >> (vertex % 8)) & 1;
+    }
+
+    /**
+     * @brief Ownership bitstring of a sample; character v is the owner of vertex v
+     */
+    std::string bitstring(std::size_t sample) const {
+        std::string bits(num_vertices_, '0');
+        for (std::size_t v = 0; v < num_vertices_; ++v) {
+            bits[v] = owner(sample, v) ? '1' : '0';
+        }
+        return bits;
+    }
+
+    bool outcome(std::size_t sample) const { return (outcomes_[sample / 8] >> (sample % 8)) & 1; }
+    double value(std::size_t sample) const { return values_.at(sample); }
+    std::uint32_t time_us(std::size_t sample) const { return times_us_[sample]; }
+
+  private:
+    std::size_t num_vertices_ = 0;
+    std::size_t samples_ = 0;
+    std::size_t owner_bytes_ = 0;
+    bool with_values_ = false;
+    std::vector<std::uint8_t> owners_;
+    std::vector<std::uint8_t> outcomes_;
+    std::vector<double> values_;
+    std::vector<std::uint32_t> times_us_;
+
+    template <typename T>
+    static void read(const std::filesystem::path &path, std::vector<T> &column, std::size_t count) {
+        std::ifstream file(path.string(), std::ios::binary);
+        std::vector<unsigned char> bytes(count * sizeof(T));
+        if (!file.read(reinterpret_cast<char *>(bytes.data()), static_cast<std::streamsize>(bytes.size()))) {
+            throw std::runtime_error("Sample store column " + path.string() + " is truncated");
+        }
+        column.resize(count);
+        for (std::size_t i = 0; i < count; ++i) {
+            column[i] = detail::load_little_endian<T>(bytes.data() + i * sizeof(T));
+        }
+    }
+};
+
+} // namespace utils
+} // namespace ggg
@@ -0,0 +1,80 @@
+#pragma once
+
+#include <algorithm>
+#include <utility>
+#include <vector>
+
+namespace ggg {
+namespace utils {
+
+/**
+ * @brief Strongly connected components of a graph given by a successor callback
+ *
+ * Iterative Tarjan: components are numbered in the order they are completed, which is a
+ * reverse topological order of the condensation. Every edge leads to a component with
+ * the same or a smaller number, so component 0 has no edges leaving it.
+ *
+ * @param num_vertices Vertices 0 .. num_vertices - 1
+ * @param for_each_successor Callable (v, visit) calling visit(w) for every edge v -> w
+ * @return Component number of every vertex and the number of components
+ */
+template <typename ForEachSuccessor>
+std::pair<std::vector<int>, int> strongly_connected_components(int num_vertices, ForEachSuccessor &&for_each_successor) {
+    std::vector<int> component(num_vertices, -1);
+    std::vector<int> index(num_vertices, -1);
+    std::vector<int> low(num_vertices, 0);
+    std::vector<char> on_stack(num_vertices, 0);
+    std::vector<int> stack;
+    std::vector<std::vector<int>> successors(num_vertices);
+    int next_index = 0;
+    int components = 0;
+
+    // Frames of the depth-first search: vertex and position in its successor list
+    std::vector<std::pair<int, std::size_t>> frames;
+    for (int root = 0; root < num_vertices; ++root) {
+        if (index[root] != -1) {
+            continue;
+        }
+        frames.emplace_back(root, 0);
+        while (!frames.empty()) {
+            auto &[v, position] = frames.back();
+            if (position == 0 && index[v] == -1) {
+                index[v] = low[v] = next_index++;
+                stack.push_back(v);
+                on_stack[v] = 1;
+                successors[v].clear();
+                for_each_successor(v, [&](int w) { successors[v].push_back(w); });
+            }
+            if (position < successors[v].size()) {
+                const int w = successors[v][position++];
+                if (index[w] == -1) {
+                    frames.emplace_back(w, 0);
+                } else if (on_stack[w]) {
+                    low[v] = std::min(low[v], index[w]);
+                }
+                continue;
+            }
+            const int finished = v;
+            frames.pop_back();
+            if (low[finished] == index[finished]) {
+                int w;
+                do {
+                    w = stack.back();
+                    stack.pop_back();
+                    on_stack[w] = 0;
+                    component[w] = components;
+                } while (w != finished);
+                components++;
+            }
+            successors[finished].clear();
+            if (!frames.empty()) {
+                const int parent = frames.back().first;
+                low[parent] = std::min(low[parent], low[finished]);
+            }
+        }
+    }
+    return {std::move(component), components};
+}
+
+} // namespace utils
+} // namespace ggg
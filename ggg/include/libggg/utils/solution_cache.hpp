@@ -0,0 +1,697 @@
+#pragma once
+
+#include "libggg/graphs/graph_concepts.hpp"
+#include "libggg/solvers/solver.hpp"
+#include <boost/graph/graph_traits.hpp>
+#include <algorithm>
+#include <cerrno>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <filesystem>
+#include <limits>
+#include <mutex>
+#include <optional>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <system_error>
+#include <tuple>
+#include <type_traits>
+#include <unordered_map>
+#include <vector>
+#include <fcntl.h>
+#include <sys/file.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace ggg {
+namespace utils {
+
+/**
+ * @brief Persistent content-addressed cache of solutions
+ *
+ * Entries are keyed by a 128-bit hash of the canonical binary form of a game (plus
+ * whatever identifies a variant of it, such as an ownership assignment) and a solver id,
+ * so repeated experiment runs, and the sampling and exact pipelines, reuse each other's
+ * solves. A cache is a directory holding
+ * - index: a 16-byte format tag followed by fixed-size records (key, segment, offset,
+ *   length and checksum of an entry), only ever appended to. Each record starts with a
+ *   magic number and a checksum of itself, so readers skip a torn or damaged record and
+ *   resynchronise on the next valid one
+ * - segment-NNNNNNNN.bin: entry payloads, appended by the one process that created the
+ *   segment and memory-mapped by readers
+ *
+ * Each writing process claims segments of its own (created exclusively), writes a
+ * payload there and only then appends its index record under an exclusive file lock, so
+ * concurrent processes never see a record before its payload. All files are in host byte
+ * order (little-endian on every supported platform).
+ */
+
+/**
+ * @brief Key of a cache entry
+ */
+struct CacheKey {
+    std::uint64_t high = 0;
+    std::uint64_t low = 0;
+
+    bool operator==(const CacheKey &) const = default;
+};
+
+struct CacheKeyHash {
+    std::size_t operator()(const CacheKey &key) const { return static_cast<std::size_t>(key.low); }
+};
+
+/**
+ * @brief Streaming 128-bit hash for cache keys (not cryptographic)
+ *
+ * Bytes are consumed as 8-byte words, each mixed into two differently seeded lanes with
+ * the splitmix64 finalizer; the length is mixed in last. A copy continues independently,
+ * so a hasher fed a common prefix (a game and a solver id) can be copied per sample.
+ */
+class KeyHasher {
+  public:
+    void update(const void *data, std::size_t bytes) {
+        const auto *input = static_cast<const unsigned char *>(data);
+        length_ += bytes;
+        while (filled_ != 0 && bytes > 0) {
+            push_byte(*input++);
+            bytes--;
+        }
+        for (; bytes >= 8; bytes -= 8, input += 8) {
+            std::uint64_t word;
+            std::memcpy(&word, input, 8);
+            absorb(word);
+        }
+        while (bytes > 0) {
+            push_byte(*input++);
+            bytes--;
+        }
+    }
+
+    /**
+     * @brief Hash a trivially copyable value by its bytes
+     */
+    template <typename T>
+        requires std::is_trivially_copyable_v<T>
+    void add(const T &value) {
+        update(&value, sizeof(T));
+    }
+
+    /**
+     * @brief Hash a string, prefixed by its length so consecutive strings cannot run together
+     */
+    void add(std::string_view text) {
+        add(static_cast<std::uint64_t>(text.size()));
+        update(text.data(), text.size());
+    }
+
+    CacheKey key() const {
+        KeyHasher last = *this;
+        if (last.filled_ != 0) {
+            last.absorb(last.word_);
+        }
+        const std::uint64_t high = mix(last.high_ ^ length_);
+        const std::uint64_t low = mix(last.low_ + length_ * 0xD6E8FEB86659FD93ULL);
+        return {mix(high ^ (low >> 32)), mix(low ^ high)};
+    }
+
+    static std::uint64_t mix(std::uint64_t x) {
+        x ^= x >> 30;
+        x *= 0xBF58476D1CE4E5B9ULL;
+        x ^= x >> 27;
+        x *= 0x94D049BB133111EBULL;
+        return x ^ (x >> 31);
+    }
+
+  private:
+    std::uint64_t high_ = 0x243F6A8885A308D3ULL;
+    std::uint64_t low_ = 0x13198A2E03707344ULL;
+    std::uint64_t word_ = 0;
+    int filled_ = 0;
+    std::uint64_t length_ = 0;
+
+    void absorb(std::uint64_t word) {
+        high_ = mix(high_ + word * 0x9E3779B97F4A7C15ULL);
+        low_ = mix((low_ ^ word) + 0xC2B2AE3D27D4EB4FULL);
+        word_ = 0;
+        filled_ = 0;
+    }
+
+    void push_byte(unsigned char byte) {
+        word_ |= std::uint64_t(byte) << (8 * filled_);
+        if (++filled_ == 8) {
+            absorb(word_);
+        }
+    }
+};
+
+/**
+ * @brief Canonical binary form of a game, the part of a cache key identifying the game
+ *
+ * The vertex count and, per vertex in index order, its player and whichever of priority
+ * and weight the graph has; then every edge as source, target and whichever of weight,
+ * discount and probability the graph has, sorted. Names and labels are left out, so
+ * renaming vertices or reordering the edges of a file keeps the form; renumbering the
+ * vertices does not, as solutions are stored by vertex index.
+ */
+template <typename GraphType>
+inline std::string canonical_game(const GraphType &graph) {
+    std::string bytes = "ggg-game-1";
+    const auto append = [&bytes](const auto &value) {
+        bytes.append(reinterpret_cast<const char *>(&value), sizeof(value));
+    };
+
+    const auto num_vertices = static_cast<std::uint64_t>(boost::num_vertices(graph));
+    append(num_vertices);
+    for (const auto v : boost::make_iterator_range(boost::vertices(graph))) {
+        append(static_cast<std::int32_t>(graph[v].player));
+        if constexpr (graphs::HasPriorityOnVertices<GraphType>) {
+            append(static_cast<std::int32_t>(graph[v].priority));
+        }
+        if constexpr (graphs::HasWeightOnVertices<GraphType>) {
+            append(static_cast<std::int64_t>(graph[v].weight));
+        }
+    }
+
+    std::vector<std::tuple<std::uint64_t, std::uint64_t, double, double, double>> edges;
+    for (const auto edge : boost::make_iterator_range(boost::edges(graph))) {
+        auto &entry = edges.emplace_back(boost::source(edge, graph), boost::target(edge, graph), 0.0, 0.0, 0.0);
+        if constexpr (graphs::HasWeightOnEdges<GraphType>) {
+            std::get<2>(entry) = graph[edge].weight;
+        }
+        if constexpr (graphs::HasDiscountOnEdges<GraphType>) {
+            std::get<3>(entry) = graph[edge].discount;
+        }
+        if constexpr (graphs::HasProbabilityOnEdges<GraphType>) {
+            std::get<4>(entry) = graph[edge].probability;
+        }
+    }
+    std::sort(edges.begin(), edges.end());
+    append(static_cast<std::uint64_t>(edges.size()));
+    for (const auto &[source, target, weight, discount, probability] : edges) {
+        append(source);
+        append(target);
+        if constexpr (graphs::HasWeightOnEdges<GraphType>) {
+            append(weight);
+        }
+        if constexpr (graphs::HasDiscountOnEdges<GraphType>) {
+            append(discount);
+        }
+        if constexpr (graphs::HasProbabilityOnEdges<GraphType>) {
+            append(probability);
+        }
+    }
+    return bytes;
+}
+
+/**
+ * @brief Solution stored in the cache
+ *
+ * Winners, strategies and values are indexed by vertex, or by position for partial
+ * solutions such as the query vertex of a sample.
+ */
+struct CachedSolution {
+    std::vector<std::int8_t> winners;   ///< Winner per vertex (0, 1, or -1 if undetermined)
+    std::vector<std::int32_t> strategy; ///< Chosen successor per vertex (-1 if none); empty if not stored
+    std::vector<double> values;         ///< Value per vertex (NaN if none); empty if not stored
+    std::string detail;                 ///< Solver-specific output, stored verbatim
+};
+
+/**
+ * @brief On-disk solution cache shared by processes and threads
+ *
+ * Entries appended by other processes after the cache was opened become visible on
+ * refresh(). Payloads are checksummed, and an entry that fails its checksum (for
+ * example after a crash) is reported as a miss.
+ */
+class SolutionCache {
+  public:
+    /**
+     * @brief Largest segment a process appends to before claiming a new one
+     */
+    static constexpr std::uint64_t segment_bytes = std::uint64_t(256) << 20;
+
+    /**
+     * @brief Open (or create) a cache
+     * @param directory Cache directory, created if missing
+     * @throws std::runtime_error if the index cannot be opened or has another format
+     */
+    explicit SolutionCache(const std::string &directory) : directory_(directory) {
+        std::filesystem::create_directories(directory_);
+        const auto path = (directory_ / "index").string();
+        index_fd_ = ::open(path.c_str(), O_RDWR | O_CREAT | O_APPEND | O_CLOEXEC, 0644);
+        if (index_fd_ < 0) {
+            throw std::runtime_error("Failed to open " + path + ": " + std::strerror(errno));
+        }
+
+        lock(LOCK_EX);
+        struct stat status {};
+        ::fstat(index_fd_, &status);
+        if (status.st_size == 0 && !write_all(index_fd_, format_tag, sizeof(format_tag))) {
+            unlock();
+            ::close(index_fd_);
+            throw std::runtime_error("Failed to initialise " + path);
+        }
+        char tag[sizeof(format_tag)] = {};
+        const bool valid = ::pread(index_fd_, tag, sizeof(tag), 0) == static_cast<ssize_t>(sizeof(tag)) &&
+                           std::memcmp(tag, format_tag, sizeof(tag)) == 0;
+        unlock();
+        if (!valid) {
+            ::close(index_fd_);
+            throw std::runtime_error("Unsupported solution cache format in " + directory);
+        }
+        index_position_ = sizeof(format_tag);
+        refresh();
+    }
+
+    ~SolutionCache() {
+        for (auto &[segment, mapping] : mappings_) {
+            ::munmap(mapping.data, mapping.size);
+        }
+        if (segment_fd_ >= 0) {
+            ::close(segment_fd_);
+        }
+        ::close(index_fd_);
+    }
+
+    SolutionCache(const SolutionCache &) = delete;
+    SolutionCache &operator=(const SolutionCache &) = delete;
+
+    /**
+     * @brief Key of a game (its canonical_game bytes) solved by a solver
+     * @param game Canonical game
+     * @param solver Solver id, including any option that changes the solution
+     */
+    static CacheKey key(std::string_view game, std::string_view solver) {
+        KeyHasher hasher;
+        hasher.add(game);
+        hasher.add(solver);
+        return hasher.key();
+    }
+
+    /**
+     * @brief Look up an entry
+     * @return The stored solution, or nothing on a miss
+     */
+    std::optional<CachedSolution> lookup(const CacheKey &key) {
+        std::lock_guard<std::mutex> guard(mutex_);
+        const auto it = entries_.find(key);
+        if (it == entries_.end()) {
+            misses_++;
+            return std::nullopt;
+        }
+        const auto *payload = map(it->second);
+        CachedSolution solution;
+        if (!payload || payload_check(payload, it->second.length) != it->second.check ||
+            !decode(payload, it->second.length, solution)) {
+            misses_++;
+            return std::nullopt;
+        }
+        hits_++;
+        return solution;
+    }
+
+    /**
+     * @brief Store an entry unless the key is already known
+     * @throws std::invalid_argument if strategy or values do not match the winners in size
+     * @throws std::runtime_error if the entry cannot be written
+     */
+    void store(const CacheKey &key, const CachedSolution &solution) {
+        if ((!solution.strategy.empty() && solution.strategy.size() != solution.winners.size()) ||
+            (!solution.values.empty() && solution.values.size() != solution.winners.size())) {
+            throw std::invalid_argument("Cached strategies and values need one entry per winner");
+        }
+        const auto payload = encode(solution);
+        if (payload.size() > std::numeric_limits<std::uint32_t>::max()) {
+            throw std::invalid_argument("Cached solution too large");
+        }
+
+        std::lock_guard<std::mutex> guard(mutex_);
+        if (entries_.count(key)) {
+            return;
+        }
+        if (segment_fd_ < 0 || segment_size_ + payload.size() > segment_bytes) {
+            claim_segment();
+        }
+        if (::pwrite(segment_fd_, payload.data(), payload.size(), static_cast<off_t>(segment_size_)) !=
+            static_cast<ssize_t>(payload.size())) {
+            throw std::runtime_error("Failed to write solution cache segment in " + directory_.string());
+        }
+
+        Record record;
+        record.high = key.high;
+        record.low = key.low;
+        record.offset = segment_size_;
+        record.segment = segment_;
+        record.length = static_cast<std::uint32_t>(payload.size());
+        record.check = payload_check(payload.data(), payload.size());
+        record.record_check = record_check(record);
+        segment_size_ += payload.size();
+
+        lock(LOCK_EX);
+        struct stat status {};
+        ::fstat(index_fd_, &status);
+        const bool written = write_all(index_fd_, &record, sizeof(record));
+        if (!written) {
+            // Readers skip a torn record anyway; cutting it off keeps the index tidy
+            static_cast<void>(::ftruncate(index_fd_, status.st_size) == 0);
+        }
+        unlock();
+        if (!written) {
+            throw std::runtime_error("Failed to append to solution cache index in " + directory_.string());
+        }
+        entries_.emplace(key, Location{record.offset, record.segment, record.length, record.check});
+        stores_++;
+    }
+
+    /**
+     * @brief Load index records appended since the last refresh (by any process)
+     *
+     * A record with a wrong magic number or checksum (torn by a crash, or damaged) is
+     * skipped byte by byte until a valid record starts; a short tail is left for the next
+     * refresh, when the record after it has been appended.
+     */
+    void refresh() {
+        std::lock_guard<std::mutex> guard(mutex_);
+        lock(LOCK_SH);
+        struct stat status {};
+        ::fstat(index_fd_, &status);
+        const auto end = static_cast<std::uint64_t>(status.st_size);
+        std::vector<unsigned char> bytes(end - std::min(end, index_position_));
+        const bool read = bytes.empty() || ::pread(index_fd_, bytes.data(), bytes.size(), static_cast<off_t>(index_position_)) ==
+                                               static_cast<ssize_t>(bytes.size());
+        unlock();
+        if (!read) {
+            return;
+        }
+        std::size_t position = 0;
+        while (bytes.size() - position >= sizeof(Record)) {
+            Record record;
+            std::memcpy(&record, bytes.data() + position, sizeof(record));
+            if (record.magic != record_magic || record.record_check != record_check(record)) {
+                ++position;
+                continue;
+            }
+            entries_.emplace(CacheKey{record.high, record.low}, Location{record.offset, record.segment, record.length, record.check});
+            position += sizeof(Record);
+        }
+        index_position_ += position;
+    }
+
+    std::size_t size() const {
+        std::lock_guard<std::mutex> guard(mutex_);
+        return entries_.size();
+    }
+
+    std::uint64_t hits() const {
+        std::lock_guard<std::mutex> guard(mutex_);
+        return hits_;
+    }
+
+    std::uint64_t misses() const {
+        std::lock_guard<std::mutex> guard(mutex_);
+        return misses_;
+    }
+
+    std::uint64_t stores() const {
+        std::lock_guard<std::mutex> guard(mutex_);
+        return stores_;
+    }
+
+  private:
+    static constexpr char format_tag[16] = "ggg-solutions-2";
+    static constexpr std::uint32_t record_magic = 0x52474747; // "GGGR"
+
+    struct Record {
+        std::uint32_t magic = record_magic;
+        std::uint32_t record_check = 0; ///< Checksum of the fields below
+        std::uint64_t high = 0;
+        std::uint64_t low = 0;
+        std::uint64_t offset = 0;
+        std::uint32_t segment = 0;
+        std::uint32_t length = 0;
+        std::uint64_t check = 0;
+    };
+    static_assert(sizeof(Record) == 48, "index records are 48 bytes");
+
+    static std::uint32_t record_check(const Record &record) {
+        constexpr std::size_t checked = offsetof(Record, high);
+        return static_cast<std::uint32_t>(
+            payload_check(reinterpret_cast<const unsigned char *>(&record) + checked, sizeof(Record) - checked));
+    }
+
+    struct Location {
+        std::uint64_t offset;
+        std::uint32_t segment;
+        std::uint32_t length;
+        std::uint64_t check;
+    };
+
+    struct Mapping {
+        void *data = nullptr;
+        std::size_t size = 0;
+    };
+
+    std::filesystem::path directory_;
+    int index_fd_ = -1;
+    std::uint64_t index_position_ = 0;
+    std::unordered_map<CacheKey, Location, CacheKeyHash> entries_;
+    std::unordered_map<std::uint32_t, Mapping> mappings_;
+    int segment_fd_ = -1;
+    std::uint32_t segment_ = 0;
+    std::uint64_t segment_size_ = 0;
+    std::uint64_t hits_ = 0;
+    std::uint64_t misses_ = 0;
+    std::uint64_t stores_ = 0;
+    mutable std::mutex mutex_;
+
+    void lock(int operation) {
+        while (::flock(index_fd_, operation) != 0 && errno == EINTR) {
+        }
+    }
+
+    void unlock() { ::flock(index_fd_, LOCK_UN); }
+
+    static bool write_all(int fd, const void *data, std::size_t bytes) {
+        const auto *input = static_cast<const char *>(data);
+        while (bytes > 0) {
+            const ssize_t written = ::write(fd, input, bytes);
+            if (written < 0 && errno == EINTR) {
+                continue;
+            }
+            if (written <= 0) {
+                return false;
+            }
+            input += written;
+            bytes -= static_cast<std::size_t>(written);
+        }
+        return true;
+    }
+
+    std::filesystem::path segment_path(std::uint32_t segment) const {
+        char name[32];
+        std::snprintf(name, sizeof(name), "segment-%08u.bin", segment);
+        return directory_ / name;
+    }
+
+    /**
+     * @brief Create a segment no other process writes to
+     */
+    void claim_segment() {
+        if (segment_fd_ >= 0) {
+            ::close(segment_fd_);
+            segment_fd_ = -1;
+        }
+        std::uint32_t candidate = 0;
+        for (const auto &file : std::filesystem::directory_iterator(directory_)) {
+            candidate += file.path().filename().string().rfind("segment-", 0) == 0 ? 1 : 0;
+        }
+        for (;; ++candidate) {
+            const auto path = segment_path(candidate).string();
+            segment_fd_ = ::open(path.c_str(), O_RDWR | O_CREAT | O_EXCL | O_CLOEXEC, 0644);
+            if (segment_fd_ >= 0) {
+                break;
+            }
+            if (errno != EEXIST) {
+                throw std::runtime_error("Failed to create " + path + ": " + std::strerror(errno));
+            }
+        }
+        segment_ = candidate;
+        segment_size_ = 0;
+    }
+
+    /**
+     * @brief Address of an entry's payload, (re)mapping its segment if needed
+     */
+    const unsigned char *map(const Location &location) {
+        const std::uint64_t end = location.offset + location.length;
+        auto &mapping = mappings_[location.segment];
+        if (mapping.size < end) {
+            if (mapping.data) {
+                ::munmap(mapping.data, mapping.size);
+                mapping = {};
+            }
+            const int fd = ::open(segment_path(location.segment).c_str(), O_RDONLY | O_CLOEXEC);
+            if (fd < 0) {
+                return nullptr;
+            }
+            struct stat status {};
+            ::fstat(fd, &status);
+            const auto size = static_cast<std::size_t>(status.st_size);
+            void *data = size > 0 ? ::mmap(nullptr, size, PROT_READ, MAP_SHARED, fd, 0) : MAP_FAILED;
+            ::close(fd);
+            if (data == MAP_FAILED) {
+                return nullptr;
+            }
+            mapping = {data, size};
+            if (size < end) {
+                return nullptr;
+            }
+        }
+        return static_cast<const unsigned char *>(mapping.data) + location.offset;
+    }
+
+    static std::uint64_t payload_check(const void *payload, std::size_t bytes) {
+        KeyHasher hasher;
+        hasher.update(payload, bytes);
+        return hasher.key().low;
+    }
+
+    /**
+     * @brief Payload layout: count (u32), flags (u8: 1 strategy, 2 values), detail size (u32),
+     * winners at 2 bits each (bit 0: player 0, bit 1: player 1), strategy (i32 each),
+     * values (f64 each), detail
+     */
+    static std::vector<unsigned char> encode(const CachedSolution &solution) {
+        const auto count = static_cast<std::uint32_t>(solution.winners.size());
+        const std::uint8_t flags = (solution.strategy.empty() ? 0 : 1) | (solution.values.empty() ? 0 : 2);
+        const auto detail_size = static_cast<std::uint32_t>(solution.detail.size());
+        std::vector<unsigned char> payload;
+        const auto append = [&payload](const void *data, std::size_t bytes) {
+            const auto *input = static_cast<const unsigned char *>(data);
+            payload.insert(payload.end(), input, input + bytes);
+        };
+        append(&count, sizeof(count));
+        append(&flags, sizeof(flags));
+        append(&detail_size, sizeof(detail_size));
+
+        std::vector<unsigned char> winners((count + 3) / 4, 0);
+        for (std::uint32_t v = 0; v < count; ++v) {
+            const int winner = solution.winners[v];
+            const unsigned bits = winner == 0 ? 1 : winner == 1 ? 2 : 0;
+            winners[v / 4] |= static_cast<unsigned char>(bits << (2 * (v % 4)));
+        }
+        append(winners.data(), winners.size());
+        append(solution.strategy.data(), solution.strategy.size() * sizeof(std::int32_t));
+        append(solution.values.data(), solution.values.size() * sizeof(double));
+        append(solution.detail.data(), solution.detail.size());
+        return payload;
+    }
+
+    static bool decode(const unsigned char *payload, std::size_t bytes, CachedSolution &solution) {
+        std::uint32_t count = 0;
+        std::uint8_t flags = 0;
+        std::uint32_t detail_size = 0;
+        constexpr std::size_t header = sizeof(count) + sizeof(flags) + sizeof(detail_size);
+        if (bytes < header) {
+            return false;
+        }
+        std::memcpy(&count, payload, sizeof(count));
+        std::memcpy(&flags, payload + sizeof(count), sizeof(flags));
+        std::memcpy(&detail_size, payload + sizeof(count) + sizeof(flags), sizeof(detail_size));
+        const std::size_t winner_bytes = (std::size_t(count) + 3) / 4;
+        const std::size_t strategy_bytes = (flags & 1) ? std::size_t(count) * sizeof(std::int32_t) : 0;
+        const std::size_t value_bytes = (flags & 2) ? std::size_t(count) * sizeof(double) : 0;
+        if (bytes != header + winner_bytes + strategy_bytes + value_bytes + detail_size) {
+            return false;
+        }
+
+        const unsigned char *input = payload + header;
+        solution.winners.resize(count);
+        for (std::uint32_t v = 0; v < count; ++v) {
+            const unsigned bits = (input[v / 4] >> (2 * (v % 4))) & 3;
+            solution.winners[v] = static_cast<std::int8_t>(bits == 1 ? 0 : bits == 2 ? 1 : -1);
+        }
+        input += winner_bytes;
+        solution.strategy.resize(strategy_bytes / sizeof(std::int32_t));
+        std::memcpy(solution.strategy.data(), input, strategy_bytes);
+        input += strategy_bytes;
+        solution.values.resize(value_bytes / sizeof(double));
+        std::memcpy(solution.values.data(), input, value_bytes);
+        input += value_bytes;
+        solution.detail.assign(reinterpret_cast<const char *>(input), detail_size);
+        return true;
+    }
+};
+
+/**
+ * @brief Winners, deterministic strategies and values of a solver's solution, for the cache
+ */
+template <typename GraphType, typename SolutionType>
+inline CachedSolution capture_solution(const GraphType &graph, const SolutionType &solution) {
+    using Vertex = typename boost::graph_traits<GraphType>::vertex_descriptor;
+    const auto num_vertices = boost::num_vertices(graph);
+    CachedSolution cached;
+    cached.winners.resize(num_vertices);
+    for (std::size_t v = 0; v < num_vertices; ++v) {
+        cached.winners[v] = static_cast<std::int8_t>(solution.get_winning_player(static_cast<Vertex>(v)));
+    }
+    if constexpr (solvers::HasStrategy<SolutionType, GraphType>) {
+        cached.strategy.assign(num_vertices, -1);
+        for (std::size_t v = 0; v < num_vertices; ++v) {
+            if (solution.has_strategy(static_cast<Vertex>(v))) {
+                cached.strategy[v] = static_cast<std::int32_t>(solution.get_strategy(static_cast<Vertex>(v)));
+            }
+        }
+    }
+    if constexpr (solvers::HasValueMapping<SolutionType, GraphType>) {
+        cached.values.assign(num_vertices, std::numeric_limits<double>::quiet_NaN());
+        for (std::size_t v = 0; v < num_vertices; ++v) {
+            if (solution.has_value(static_cast<Vertex>(v))) {
+                cached.values[v] = static_cast<double>(solution.get_value(static_cast<Vertex>(v)));
+            }
+        }
+    }
+    return cached;
+}
+
+/**
+ * @brief Rebuild a solver's solution from a cached one
+ * @return False if the cached solution does not cover the graph's vertices
+ */
+template <typename GraphType, typename SolutionType>
+inline bool restore_solution(const GraphType &graph, const CachedSolution &cached, SolutionType &solution) {
+    using Vertex = typename boost::graph_traits<GraphType>::vertex_descriptor;
+    const auto num_vertices = boost::num_vertices(graph);
+    if (cached.winners.size() != num_vertices) {
+        return false;
+    }
+    for (std::size_t v = 0; v < num_vertices; ++v) {
+        if (cached.winners[v] >= 0) {
+            solution.set_winning_player(static_cast<Vertex>(v), cached.winners[v]);
+        }
+    }
+    if constexpr (solvers::HasStrategy<SolutionType, GraphType>) {
+        for (std::size_t v = 0; v < cached.strategy.size(); ++v) {
+            if (cached.strategy[v] >= 0) {
+                solution.set_strategy(static_cast<Vertex>(v), static_cast<Vertex>(cached.strategy[v]));
+            }
+        }
+    }
+    if constexpr (solvers::HasValueMapping<SolutionType, GraphType>) {
+        for (std::size_t v = 0; v < cached.values.size(); ++v) {
+            if (!std::isnan(cached.values[v])) {
+                solution.set_value(static_cast<Vertex>(v), static_cast<typename SolutionType::Value>(cached.values[v]));
+            }
+        }
+    }
+    solution.set_solved(true);
+    return true;
+}
+
+} // namespace utils
+} // namespace ggg
@@ -2,12 +2,17 @@
 
 #include "libggg/solvers/solver.hpp"
 #include "libggg/utils/logging.hpp"
+#include "libggg/utils/solution_cache.hpp"
 #include <boost/graph/adjacency_list.hpp>
 #include <boost/program_options.hpp>
 #include <chrono>
 #include <concepts>
 #include <iostream>
 #include <memory>
+#include <optional>
+#include <set>
+#include <sstream>
+#include <string>
 #include <vector>
 
 namespace ggg {
@@ -25,6 +30,20 @@ concept HasStatistics = requires(const SolutionType &solution) {
     { solution.get_statistics() } -> std::convertible_to<std::map<std::string, std::string>>;
 };
 
+// C++20 concept to detect solvers with their own command line options
+template <typename SolverType>
+concept HasCommandLineOptions = requires(boost::program_options::options_description &desc,
+                                         const boost::program_options::variables_map &vm) {
+    SolverType::add_options(desc);
+    { SolverType::from_options(vm) } -> std::same_as<SolverType>;
+};
+
+// C++20 concept to detect solvers reporting statistics of their last solve
+template <typename SolverType>
+concept HasSolverStatistics = requires(const SolverType &solver) {
+    { solver.get_statistics() } -> std::convertible_to<std::map<std::string, std::string>>;
+};
+
 /**
  * @brief Generic wrapper for game solvers
  * @template GraphType The graph type (ParityGraph, MeanPayoffGraph)
@@ -44,6 +63,10 @@ class GameSolverWrapper {
         desc.add_options()("output,o", boost::program_options::value<std::string>()->default_value("-"), "Output file (default: stdout)");
         desc.add_options()("time-only,t", "Only output time to solve (in milliseconds)");
         desc.add_options()("solver-name", "Output solver name");
+        desc.add_options()("cache-dir", boost::program_options::value<std::string>(), "Reuse and store solutions in this solution cache directory");
+        if constexpr (HasCommandLineOptions<SolverType>) {
+            SolverType::add_options(desc);
+        }
 
         // Add positional argument for input file
         boost::program_options::positional_options_description pos_desc;
@@ -242,6 +265,58 @@ class GameSolverWrapper {
         }
     }
 
+    /**
+     * @brief Create the solver, passing the command line to solvers that take options
+     */
+    static SolverType make_solver(const boost::program_options::variables_map &vm) {
+        if constexpr (HasCommandLineOptions<SolverType>) {
+            return SolverType::from_options(vm);
+        } else {
+            return SolverType();
+        }
+    }
+
+    /**
+     * @brief Solver id of a cache key: the solver name and every solver option as key=value
+     *
+     * Options of the wrapper itself do not change the solution and are left out.
+     * @return The id, or nothing if an option has a type that cannot be spelled out
+     */
+    static std::optional<std::string> solver_id(const SolverType &solver, const boost::program_options::variables_map &vm) {
+        static const std::set<std::string> wrapper_options = {"help", "csv", "input", "output", "time-only",
+                                                              "solver-name", "cache-dir", "verbose"};
+        std::ostringstream id;
+        id << solver.get_name();
+        for (const auto &[name, option] : vm) {
+            if (wrapper_options.count(name)) {
+                continue;
+            }
+            id << ";" << name << "=";
+            const auto &value = option.value();
+            if (value.empty()) {
+                continue;
+            }
+            if (const auto *text = boost::any_cast<std::string>(&value)) {
+                id << *text;
+            } else if (const auto *integer = boost::any_cast<int>(&value)) {
+                id << *integer;
+            } else if (const auto *count = boost::any_cast<long>(&value)) {
+                id << *count;
+            } else if (const auto *size = boost::any_cast<std::size_t>(&value)) {
+                id << *size;
+            } else if (const auto *unsigned_integer = boost::any_cast<unsigned int>(&value)) {
+                id << *unsigned_integer;
+            } else if (const auto *real = boost::any_cast<double>(&value)) {
+                id << std::hexfloat << *real << std::defaultfloat;
+            } else if (const auto *flag = boost::any_cast<bool>(&value)) {
+                id << *flag;
+            } else {
+                return std::nullopt;
+            }
+        }
+        return id.str();
+    }
+
   public:
     template <typename ParserFunc>
     static int run(int argc, char *argv[], ParserFunc parser_func) {
@@ -277,20 +352,41 @@ class GameSolverWrapper {
             LGG_INFO("Successfully parsed game with ", boost::num_vertices(*graph), " vertices");
 
             // Create solver and measure time
-            SolverType solver;
+            SolverType solver = make_solver(vm);
             LGG_DEBUG("Starting solver: ", solver.get_name());
 
             static_assert(HasSolveMethod<SolverType, GraphType>,
                           "Solver must have solve() method");
 
+            // Solutions are looked up before solving and stored after a successful solve
+            std::unique_ptr<SolutionCache> cache;
+            CacheKey key;
+            if (vm.count("cache-dir")) {
+                const auto id = solver_id(solver, vm);
+                if (id) {
+                    cache = std::make_unique<SolutionCache>(vm["cache-dir"].as<std::string>());
+                    key = SolutionCache::key(canonical_game(*graph), *id);
+                } else {
+                    std::cerr << "Warning: solver options cannot be part of a cache key, solving without the cache" << std::endl;
+                }
+            }
+
             auto start = std::chrono::high_resolution_clock::now();
-            auto solution = solver.solve(*graph);
+            decltype(solver.solve(*graph)) solution;
+            bool cache_hit = false;
+            if (cache) {
+                const auto cached = cache->lookup(key);
+                cache_hit = cached && restore_solution(*graph, *cached, solution);
+            }
+            if (!cache_hit) {
+                solution = solver.solve(*graph);
+            }
             auto end = std::chrono::high_resolution_clock::now();
 
             auto duration = std::chrono::duration_cast<std::chrono::microseconds>(end - start);
             double time_to_solve = duration.count() / 1000.0;
 
-            LGG_DEBUG("Solver completed in ", time_to_solve, " milliseconds");
+            LGG_DEBUG("Solver completed in ", time_to_solve, " milliseconds", cache_hit ? " (cached)" : "");
 
             if (!solution.is_solved()) {
                 LGG_ERROR("Solver failed to solve the game");
@@ -299,6 +395,9 @@ class GameSolverWrapper {
             }
 
             LGG_INFO("Game solved successfully");
+            if (cache && !cache_hit) {
+                cache->store(key, capture_solution(*graph, solution));
+            }
 
             // Output results
             if (vm.count("time-only")) {
@@ -308,6 +407,14 @@ class GameSolverWrapper {
                     output_csv(*graph, solution, time_to_solve);
                 } else {
                     output_human(*graph, solution, time_to_solve);
+                    if (cache_hit) {
+                        std::cout << "Solution cache: hit" << std::endl;
+                    } else if constexpr (HasSolverStatistics<SolverType>) {
+                        std::cout << "Solver statistics:" << std::endl;
+                        for (const auto &[key, value] : solver.get_statistics()) {
+                            std::cout << "  " << key << ": " << value << std::endl;
+                        }
+                    }
                 }
             }
 
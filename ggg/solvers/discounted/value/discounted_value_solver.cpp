@@ -1,6 +1,7 @@
 #include "discounted_value_solver.hpp"
 #include "libggg/utils/logging.hpp"
 #include <boost/graph/graph_utility.hpp>
+#include <chrono>
 #include <map>
 #include <random>
 
@@ -43,6 +44,16 @@ auto DiscountedValueSolver::solve(const graphs::DiscountedGraph &graph) -> RSQSo
         BAtr[vertex] = true;
     }
 
+    statistics_ = ValueIterationStatistics();
+    if (options_.method != ValueIterationMethod::Worklist) {
+        iterate_compressed(graph);
+        TAtr.clear();
+        if (!statistics_.converged) {
+            LGG_WARN("Value iteration stopped after ", statistics_.sweeps, " sweeps with residual ", statistics_.residual);
+        }
+    }
+    const auto iteration_start = std::chrono::steady_clock::now();
+
     // Main improvement loop
     int pos;
     int best_succ;
@@ -97,6 +108,11 @@ auto DiscountedValueSolver::solve(const graphs::DiscountedGraph &graph) -> RSQSo
         }
     }
 
+    if (options_.method == ValueIterationMethod::Worklist) {
+        statistics_.updates = iterations;
+        statistics_.time_ms = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - iteration_start).count();
+    }
+
     // Set solution results
     for (const auto &vertex : boost::make_iterator_range(vertices_begin, vertices_end)) {
         if (sol[vertex] >= 0) {
@@ -110,8 +126,37 @@ auto DiscountedValueSolver::solve(const graphs::DiscountedGraph &graph) -> RSQSo
 
     LGG_TRACE("Solved with ", iterations, " iterations");
     LGG_TRACE("Solved with ", lifts, " lifts");
-    solution.set_solved(true);
+    solution.set_solved(statistics_.converged);
     return solution;
 }
 
+BellmanSystem DiscountedValueSolver::make_system(const graphs::DiscountedGraph &graph) {
+    const int num_vertices = boost::num_vertices(graph);
+    BellmanSystem system(num_vertices);
+    for (const auto &vertex : boost::make_iterator_range(boost::vertices(graph))) {
+        system.player[vertex] = graph[vertex].player;
+        for (const auto &gedge : boost::make_iterator_range(boost::out_edges(vertex, graph))) {
+            const auto SUCCESSOR = boost::target(gedge, graph);
+            const auto CURRE = edge(vertex, SUCCESSOR, graph);
+            system.add_choice(SUCCESSOR, graph[CURRE.first].weight); // Self loops are solved away by end_vertex
+            system.add_term(SUCCESSOR, graph[CURRE.first].discount);
+        }
+        system.end_vertex();
+    }
+    return system;
+}
+
+void DiscountedValueSolver::iterate_compressed(const graphs::DiscountedGraph &graph) {
+    const int num_vertices = boost::num_vertices(graph);
+    const BellmanSystem system = make_system(graph);
+    std::vector<double> values(num_vertices, 0.0);
+    statistics_ = iterate_values(system, options_, values);
+    for (const auto &vertex : boost::make_iterator_range(boost::vertices(graph))) {
+        double best = 0.0;
+        const int choice = system.best_choice(vertex, values, best);
+        sol[vertex] = values[vertex];
+        strategy[vertex] = choice < 0 ? -1 : system.choice_successor[choice];
+    }
+}
+
 } // namespace ggg::solvers
\ No newline at end of file
@@ -2,6 +2,7 @@
 
 #include "libggg/graphs/discounted_graph.hpp"
 #include "libggg/solvers/solver.hpp"
+#include "libggg/solvers/value_iteration.hpp"
 #include <boost/dynamic_bitset.hpp>
 #include <map>
 #include "../../uintqueue.hpp"
@@ -12,10 +13,34 @@ namespace ggg::solvers {
  * @brief Value Iteration solver for discounted games
  *
  * Value Iteration implementation for discounted games
+ *
+ * The default worklist method iterates until no value changes. The other methods of
+ * ValueIterationOptions sweep a compressed Bellman operator (see iterate_values) and stop
+ * once every value is provably within the tolerance of the fixpoint.
  * @complexity Time: O(?), Space: O(?) - exponential, bounded by the maximum number of updates
  */
 class DiscountedValueSolver : public Solver<graphs::DiscountedGraph, RSQSolution<graphs::DiscountedGraph>> {
   public:
+    DiscountedValueSolver() = default;
+
+    /**
+     * @brief Constructor selecting the value iteration method
+     * @param options Method, tolerance and acceleration parameters
+     */
+    explicit DiscountedValueSolver(const ValueIterationOptions &options) : options_(options) {}
+
+    /**
+     * @brief Register the solver's command line options
+     */
+    static void add_options(boost::program_options::options_description &desc) { add_value_iteration_options(desc); }
+
+    /**
+     * @brief Create a solver from parsed command line options
+     */
+    static DiscountedValueSolver from_options(const boost::program_options::variables_map &vm) {
+        return DiscountedValueSolver(value_iteration_options(vm));
+    }
+
     /**
      * @brief Solve the discounted game using Value Iteration algorithm
      * @param graph Discounted graph to solve
@@ -31,7 +56,26 @@ class DiscountedValueSolver : public Solver<graphs::DiscountedGraph, RSQSolution
         return "Value Iteration Discounted Game Solver";
     }
 
+    /**
+     * @brief Compressed Bellman equations of a discounted game, self loops solved away
+     */
+    static BellmanSystem make_system(const graphs::DiscountedGraph &graph);
+
+    /**
+     * @brief Work done by the last solve
+     */
+    [[nodiscard]] auto get_statistics() const -> std::map<std::string, std::string> {
+        return statistics_.to_map(options_.method, options_.precision);
+    }
+
   private:
+    /**
+     * @brief Fill sol and strategy by sweeping the compressed Bellman operator
+     */
+    void iterate_compressed(const graphs::DiscountedGraph &graph);
+
+    ValueIterationOptions options_;
+    ValueIterationStatistics statistics_;
     // Statistic fields
     uint lifts;      // Total number of lifts needed to reach the fix point
     uint iterations; // Total number of iteration for the game solution
@@ -0,0 +1,176 @@
+#include "libggg/graphs/discounted_graph.hpp"
+#include "libggg/solvers/value_lanes.hpp"
+#include "random_games.hpp"
+#include <boost/graph/adjacency_list.hpp>
+#include <cmath>
+#include <random>
+#include <string>
+
+#define BOOST_TEST_MODULE Discounted Value Solver Test Suite
+#include <boost/test/unit_test.hpp>
+
+#include "discounted_value_solver.hpp"
+
+using namespace ggg;
+using namespace ggg::graphs;
+using ggg::testing::random_discounted_game;
+
+namespace {
+solvers::ValueIterationOptions options_for(solvers::ValueIterationMethod method) {
+    solvers::ValueIterationOptions options;
+    options.method = method;
+    options.tolerance = 1e-7;
+    return options;
+}
+} // namespace
+
+BOOST_AUTO_TEST_SUITE(DiscountedValueSolverTests)
+
+BOOST_AUTO_TEST_CASE(TestTwoCycleValues) {
+    // v0 -> v1 -> v0 with weights 1 and -1 and discount 0.99: v0 = (1 - 0.99) / (1 - 0.99^2)
+    DiscountedGraph graph;
+    auto v0 = add_vertex(graph, "v0", 0);
+    auto v1 = add_vertex(graph, "v1", 1);
+    add_edge(graph, v0, v1, "", 1.0, 0.99);
+    add_edge(graph, v1, v0, "", -1.0, 0.99);
+    const double expected = (1.0 - 0.99) / (1.0 - 0.99 * 0.99);
+
+    for (const auto method : {solvers::ValueIterationMethod::GaussSeidel, solvers::ValueIterationMethod::Sor,
+                              solvers::ValueIterationMethod::Anderson}) {
+        solvers::DiscountedValueSolver solver(options_for(method));
+        auto solution = solver.solve(graph);
+        BOOST_REQUIRE(solution.is_solved());
+        BOOST_CHECK_SMALL(solution.get_value(v0) - expected, 1e-7);
+        BOOST_CHECK_EQUAL(solution.get_winning_player(v0), 0);
+        BOOST_CHECK_EQUAL(solution.get_winning_player(v1), 1);
+    }
+}
+
+BOOST_AUTO_TEST_CASE(TestSelfLoopsAreSolvedAway) {
+    // A vertex choosing between a self-loop worth 2 / (1 - 0.9) and an edge to a sink worth 5
+    solvers::BellmanSystem system(2);
+    system.player = {0, 0};
+    system.add_choice(0, 2.0);
+    system.add_term(0, 0.9);
+    system.add_choice(1, 5.0);
+    system.add_term(1, 0.9);
+    system.end_vertex();
+    system.add_choice(1, 0.0);
+    system.add_term(1, 0.5);
+    system.end_vertex();
+    BOOST_CHECK_CLOSE(system.discount, 0.9, 1e-9);
+
+    std::vector<double> values(2, 0.0);
+    auto statistics = solvers::iterate_values(system, options_for(solvers::ValueIterationMethod::GaussSeidel), values);
+    BOOST_CHECK(statistics.converged);
+    BOOST_CHECK_CLOSE(values[0], 20.0, 1e-6);
+    BOOST_CHECK_SMALL(values[1], 1e-12);
+}
+
+BOOST_AUTO_TEST_CASE(TestTopologicalSolvesChainsInOneStep) {
+    // v0 -> v1 -> ... -> v9 with a self loop on v9: every component is a single vertex
+    DiscountedGraph graph;
+    for (int v = 0; v < 10; ++v) {
+        add_vertex(graph, "v" + std::to_string(v), v % 2);
+    }
+    for (int v = 0; v < 9; ++v) {
+        add_edge(graph, v, v + 1, "", 1.0, 0.5);
+    }
+    add_edge(graph, 9, 9, "", 1.0, 0.5);
+
+    auto options = options_for(solvers::ValueIterationMethod::GaussSeidel);
+    options.topological = true;
+    solvers::DiscountedValueSolver solver(options);
+    auto solution = solver.solve(graph);
+    BOOST_REQUIRE(solution.is_solved());
+    const auto statistics = solver.get_statistics();
+    BOOST_CHECK_EQUAL(statistics.at("components"), "10");
+    BOOST_CHECK_EQUAL(statistics.at("trivial_components"), "10");
+    BOOST_CHECK_EQUAL(statistics.at("updates"), "10");
+    for (int v = 0; v < 10; ++v) {
+        BOOST_CHECK_CLOSE(solution.get_value(v), 2.0, 1e-9);
+    }
+}
+
+BOOST_AUTO_TEST_CASE(TestAcceleratedMethodsMatchWorklist) {
+    std::mt19937 rng(17);
+    for (int round = 0; round < 40; ++round) {
+        const bool near_one = round % 2 == 0;
+        auto graph = random_discounted_game(60, near_one ? 0.95 : 0.1, 0.99, rng);
+        solvers::DiscountedValueSolver worklist;
+        auto expected = worklist.solve(graph);
+        BOOST_REQUIRE(expected.is_solved());
+
+        for (const auto method : {solvers::ValueIterationMethod::GaussSeidel, solvers::ValueIterationMethod::Sor,
+                                  solvers::ValueIterationMethod::Anderson}) {
+            auto options = options_for(method);
+            options.topological = round % 4 < 2;
+            solvers::DiscountedValueSolver solver(options);
+            auto solution = solver.solve(graph);
+            BOOST_REQUIRE(solution.is_solved());
+            const auto statistics = solver.get_statistics();
+            BOOST_CHECK_EQUAL(statistics.at("method"), solvers::to_string(method));
+            BOOST_CHECK_LE(std::stod(statistics.at("error_bound")), 1e-7);
+            for (const auto vertex : boost::make_iterator_range(boost::vertices(graph))) {
+                BOOST_CHECK_SMALL(solution.get_value(vertex) - expected.get_value(vertex), 1e-6);
+            }
+        }
+    }
+}
+
+BOOST_AUTO_TEST_CASE(TestReducedPrecisionMeetsTolerance) {
+    std::mt19937 rng(29);
+    for (int round = 0; round < 20; ++round) {
+        auto graph = random_discounted_game(80, 0.9, 0.99, rng);
+        solvers::DiscountedValueSolver worklist;
+        auto expected = worklist.solve(graph);
+        BOOST_REQUIRE(expected.is_solved());
+
+        for (const auto precision : {solvers::ValuePrecision::Float, solvers::ValuePrecision::BFloat16}) {
+            auto options = options_for(round % 2 == 0 ? solvers::ValueIterationMethod::GaussSeidel
+                                                      : solvers::ValueIterationMethod::Anderson);
+            options.precision = precision;
+            options.topological = round % 4 < 2;
+            solvers::DiscountedValueSolver solver(options);
+            auto solution = solver.solve(graph);
+            BOOST_REQUIRE(solution.is_solved());
+            const auto statistics = solver.get_statistics();
+            BOOST_CHECK_EQUAL(statistics.at("precision"), solvers::to_string(precision));
+            BOOST_CHECK_GT(std::stol(statistics.at("coarse_sweeps")), 0);
+            BOOST_CHECK_LE(std::stod(statistics.at("error_bound")), 1e-7);
+            for (const auto vertex : boost::make_iterator_range(boost::vertices(graph))) {
+                BOOST_CHECK_SMALL(solution.get_value(vertex) - expected.get_value(vertex), 1e-6);
+            }
+        }
+    }
+}
+
+BOOST_AUTO_TEST_CASE(TestLanesMatchSingleSamples) {
+    std::mt19937 rng(41);
+    for (int round = 0; round < 10; ++round) {
+        auto graph = random_discounted_game(70, round % 2 == 0 ? 0.95 : 0.1, 0.99, rng);
+        const auto system = solvers::DiscountedValueSolver::make_system(graph);
+        solvers::value_lanes::Owners owners(boost::num_vertices(graph));
+        for (auto &owner : owners) {
+            owner = static_cast<std::uint8_t>(rng());
+        }
+        std::vector<double> values;
+        const auto statistics = solvers::value_lanes::iterate(system, owners, options_for(solvers::ValueIterationMethod::GaussSeidel), values);
+        BOOST_CHECK(statistics.converged);
+        BOOST_CHECK_LE(statistics.error_bound, 1e-7);
+
+        for (int lane = 0; lane < solvers::value_lanes::lane_count; ++lane) {
+            for (const auto vertex : boost::make_iterator_range(boost::vertices(graph))) {
+                graph[vertex].player = (owners[vertex] >> lane) & 1;
+            }
+            solvers::DiscountedValueSolver worklist;
+            auto expected = worklist.solve(graph);
+            BOOST_REQUIRE(expected.is_solved());
+            for (const auto vertex : boost::make_iterator_range(boost::vertices(graph))) {
+                BOOST_CHECK_SMALL(values[vertex * solvers::value_lanes::lane_count + lane] - expected.get_value(vertex), 1e-6);
+            }
+        }
+    }
+}
+
+BOOST_AUTO_TEST_SUITE_END()
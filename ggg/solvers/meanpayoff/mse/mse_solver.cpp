@@ -1,11 +1,207 @@
 #include "mse_solver.hpp"
 #include "libggg/utils/logging.hpp"
+#include "libggg/utils/scc.hpp"
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <deque>
 #include <map>
+#include <mutex>
 #include <queue>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <utility>
 
 namespace ggg {
 namespace solvers {
 
+namespace {
+
+/**
+ * @brief Components smaller than this are lifted by one thread even when more are allowed
+ */
+constexpr std::size_t parallel_min_vertices = 512;
+
+/**
+ * @brief Work queue of one lifting thread; other threads steal from its back
+ */
+struct Worklist {
+    std::mutex mutex;
+    std::deque<int> items;
+};
+
+/**
+ * @brief Lift one component to its least fixpoint with several threads
+ *
+ * Lifting is monotone, so updates may be applied in any order and interleaving. Cost and
+ * strategy of a vertex share one atomic word that only grows by compare-and-swap; the
+ * minimiser's supporting-successor counts are decremented atomically when a successor
+ * stops supporting. A vertex recounts after each pop and then rechecks the successors it
+ * counted, so a decrement lost to the recount still requeues it. Threads stop when no
+ * vertex is queued or being processed.
+ *
+ * @param position Index of every vertex in its component's member list
+ * @return Work queue pops and cost increases
+ */
+std::pair<int, int> lift_component_parallel(const std::vector<int> &scc, int c, const std::vector<int> &component,
+                                            const std::vector<int> &position,
+                                            const std::vector<int> &player, const std::vector<int> &weight,
+                                            const std::vector<std::vector<int>> &successors,
+                                            const std::vector<std::vector<int>> &predecessors, int local_limit,
+                                            int threads, const std::vector<int> &ready, std::vector<int> &current_cost,
+                                            std::vector<int> &current_strategy, const std::vector<int> &current_count) {
+    // State of the component's vertices by position; exits are read from current_cost, which stays fixed
+    const auto pack = [](int cost, int strategy) {
+        return (static_cast<std::uint64_t>(cost) << 32) | static_cast<std::uint32_t>(strategy + 1);
+    };
+    std::vector<std::atomic<std::uint64_t>> state(scc.size());
+    std::vector<std::atomic<int>> count(scc.size());
+    std::vector<std::atomic<bool>> queued(scc.size());
+    for (std::size_t i = 0; i < scc.size(); ++i) {
+        state[i].store(pack(current_cost[scc[i]], current_strategy[scc[i]]), std::memory_order_relaxed);
+        count[i].store(current_count[scc[i]], std::memory_order_relaxed);
+        queued[i].store(false, std::memory_order_relaxed);
+    }
+    const auto cost_of = [&](int vertex) {
+        const int cost = component[vertex] == c ? static_cast<int>(state[position[vertex]].load() >> 32) : current_cost[vertex];
+        return std::min(cost, local_limit);
+    };
+    const auto lifted = [&](int cost, int vertex) { return cost >= local_limit ? local_limit : std::min(cost + weight[vertex], local_limit); };
+
+    std::vector<Worklist> worklists(threads);
+    std::atomic<long> pending{static_cast<long>(ready.size())};
+    for (std::size_t i = 0; i < ready.size(); ++i) {
+        queued[position[ready[i]]].store(true, std::memory_order_relaxed);
+        worklists[i % threads].items.push_back(ready[i]);
+    }
+    std::atomic<int> iterations{0};
+    std::atomic<int> lifts{0};
+
+    const auto worker = [&](int self) {
+        int local_iterations = 0;
+        int local_lifts = 0;
+        const auto push = [&](int vertex) {
+            if (queued[position[vertex]].exchange(true)) {
+                return;
+            }
+            pending.fetch_add(1);
+            const std::lock_guard<std::mutex> lock(worklists[self].mutex);
+            worklists[self].items.push_back(vertex);
+        };
+        const auto take = [&](int &vertex) {
+            for (int k = 0; k < threads; ++k) {
+                auto &worklist = worklists[(self + k) % threads];
+                const std::lock_guard<std::mutex> lock(worklist.mutex);
+                if (!worklist.items.empty()) {
+                    if (k == 0) {
+                        vertex = worklist.items.front();
+                        worklist.items.pop_front();
+                    } else {
+                        vertex = worklist.items.back();
+                        worklist.items.pop_back();
+                    }
+                    return true;
+                }
+            }
+            return false;
+        };
+
+        int POS = 0;
+        while (true) {
+            if (!take(POS)) {
+                if (pending.load() == 0) {
+                    break;
+                }
+                std::this_thread::yield();
+                continue;
+            }
+            local_iterations++;
+            const int p = position[POS];
+            queued[p].store(false);
+
+            // Best successor from the current costs
+            int best_successor = -1;
+            int best_cost = 0;
+            for (const int SUCCESSOR : successors[POS]) {
+                const int cost = cost_of(SUCCESSOR);
+                if (best_successor == -1 || (player[POS] ? cost < best_cost : cost > best_cost)) {
+                    best_successor = SUCCESSOR;
+                    best_cost = cost;
+                }
+            }
+            const int target = best_successor == -1 ? std::min(std::max(weight[POS], 0), local_limit) : lifted(best_cost, POS);
+
+            // Monotone update of cost (and of the maximiser's strategy with it)
+            std::uint64_t current = state[p].load();
+            const int old_cost = static_cast<int>(current >> 32);
+            bool raised = false;
+            while (static_cast<int>(current >> 32) < target) {
+                const int strategy = player[POS] ? static_cast<int>(current & 0xffffffffu) - 1 : best_successor;
+                if (state[p].compare_exchange_weak(current, pack(target, strategy))) {
+                    raised = true;
+                    break;
+                }
+            }
+            const int new_cost = raised ? target : static_cast<int>(current >> 32);
+            local_lifts += raised ? 1 : 0;
+
+            if (player[POS] && new_cost < local_limit) {
+                // Recount the supporting successors, then recheck them against a lost decrement
+                int supporting = 0;
+                for (const int SUCCESSOR : successors[POS]) {
+                    supporting += lifted(cost_of(SUCCESSOR), POS) <= new_cost ? 1 : 0;
+                }
+                count[p].store(supporting);
+                int still = 0;
+                for (const int SUCCESSOR : successors[POS]) {
+                    still += lifted(cost_of(SUCCESSOR), POS) <= new_cost ? 1 : 0;
+                }
+                if (still < supporting || supporting == 0) {
+                    push(POS);
+                }
+            }
+
+            // Requeue the predecessors in the component that the new cost may lift
+            if (raised) {
+                for (const int PREDECESSOR : predecessors[POS]) {
+                    const int predecessor_cost = static_cast<int>(state[position[PREDECESSOR]].load() >> 32);
+                    if (predecessor_cost >= local_limit || lifted(new_cost, PREDECESSOR) <= predecessor_cost) {
+                        continue;
+                    }
+                    if (!player[PREDECESSOR]) {
+                        push(PREDECESSOR);
+                    } else if (lifted(old_cost, PREDECESSOR) <= predecessor_cost &&
+                               count[position[PREDECESSOR]].fetch_sub(1) <= 1) {
+                        push(PREDECESSOR);
+                    }
+                }
+            }
+            pending.fetch_sub(1);
+        }
+        iterations.fetch_add(local_iterations);
+        lifts.fetch_add(local_lifts);
+    };
+
+    std::vector<std::thread> pool;
+    for (int t = 1; t < threads; ++t) {
+        pool.emplace_back(worker, t);
+    }
+    worker(0);
+    for (auto &thread : pool) {
+        thread.join();
+    }
+
+    for (std::size_t i = 0; i < scc.size(); ++i) {
+        const std::uint64_t word = state[i].load();
+        current_cost[scc[i]] = static_cast<int>(word >> 32);
+        current_strategy[scc[i]] = static_cast<int>(word & 0xffffffffu) - 1;
+    }
+    return {iterations.load(), lifts.load()};
+}
+
+} // namespace
+
 RSQSolution<graphs::MeanPayoffGraph, DeterministicStrategy<graphs::MeanPayoffGraph>, int> MSESolver::solve(const graphs::MeanPayoffGraph &graph) {
     LGG_DEBUG("Mean payoff MSE solver starting with ", boost::num_vertices(graph), " vertices");
 
@@ -15,174 +211,312 @@ RSQSolution<graphs::MeanPayoffGraph, DeterministicStrategy<graphs::MeanPayoffGra
     // Base case: empty game
     if (boost::num_vertices(graph) == 0) {
         LGG_TRACE("Empty game - returning solved");
+        costs_.clear();
+        owners_.clear();
+        weights_.clear();
+        successors_.clear();
         solution.set_solved(true);
         return solution;
     }
 
+    return lift(graph, std::vector<int>(boost::num_vertices(graph), 0));
+}
+
+RSQSolution<graphs::MeanPayoffGraph, DeterministicStrategy<graphs::MeanPayoffGraph>, int> MSESolver::solve(
+    const graphs::MeanPayoffGraph &graph, const std::vector<int> &initial_costs) {
+    if (initial_costs.size() != boost::num_vertices(graph)) {
+        throw std::invalid_argument("Initial costs have " + std::to_string(initial_costs.size()) + " values, expected " +
+                                    std::to_string(boost::num_vertices(graph)));
+    }
+    return lift(graph, initial_costs);
+}
+
+RSQSolution<graphs::MeanPayoffGraph, DeterministicStrategy<graphs::MeanPayoffGraph>, int> MSESolver::solve_after_flip(
+    const graphs::MeanPayoffGraph &graph, graphs::MeanPayoffGraph::vertex_descriptor flipped) {
+    // Only the owner of flipped may differ from the arena of the last solve
+    bool same_arena = costs_.size() == boost::num_vertices(graph) && flipped < boost::num_vertices(graph);
+    for (const auto &vertex : boost::make_iterator_range(boost::vertices(graph))) {
+        if (!same_arena) {
+            break;
+        }
+        same_arena = weights_[vertex] == graph[vertex].weight && (vertex == flipped || owners_[vertex] == graph[vertex].player) &&
+                     successors_[vertex].size() == boost::out_degree(vertex, graph);
+        int position = 0;
+        for (const auto &edge : boost::make_iterator_range(boost::out_edges(vertex, graph))) {
+            if (!same_arena) {
+                break;
+            }
+            same_arena = successors_[vertex][position++] == static_cast<int>(boost::target(edge, graph));
+        }
+    }
+    if (!same_arena) {
+        throw std::invalid_argument("solve_after_flip needs an earlier solve of the same arena");
+    }
+    std::vector<int> initial = costs_;
+
+    if (graph[flipped].player) {
+        // The minimiser gained the vertex: costs can only drop, and only where the flipped
+        // vertex is reachable, so its backward cone restarts from zero
+        std::vector<std::vector<graphs::MeanPayoffGraph::vertex_descriptor>> predecessors(boost::num_vertices(graph));
+        for (const auto &vertex : boost::make_iterator_range(boost::vertices(graph))) {
+            for (const auto &edge : boost::make_iterator_range(boost::out_edges(vertex, graph))) {
+                predecessors[boost::target(edge, graph)].push_back(vertex);
+            }
+        }
+        std::vector<bool> in_cone(boost::num_vertices(graph), false);
+        std::vector<graphs::MeanPayoffGraph::vertex_descriptor> stack{flipped};
+        in_cone[flipped] = true;
+        while (!stack.empty()) {
+            const auto vertex = stack.back();
+            stack.pop_back();
+            initial[vertex] = 0;
+            for (const auto predecessor : predecessors[vertex]) {
+                if (!in_cone[predecessor]) {
+                    in_cone[predecessor] = true;
+                    stack.push_back(predecessor);
+                }
+            }
+        }
+    }
+
+    // The maximiser gained the vertex: the previous fixpoint lies below the new one
+    return lift(graph, initial);
+}
+
+RSQSolution<graphs::MeanPayoffGraph, DeterministicStrategy<graphs::MeanPayoffGraph>, int> MSESolver::lift(
+    const graphs::MeanPayoffGraph &graph, const std::vector<int> &initial_costs) {
+    RSQSolution<graphs::MeanPayoffGraph, DeterministicStrategy<graphs::MeanPayoffGraph>, int> solution;
+    using Vertex = graphs::MeanPayoffGraph::vertex_descriptor;
+    const int n = static_cast<int>(boost::num_vertices(graph));
+
     // Algorithm state variables
     int iterations = 0;
     int lifts = 0;
     int limit = 0;
 
-    std::vector<graphs::MeanPayoffGraph::vertex_descriptor> current_strategy(
-        boost::num_vertices(graph),
-        boost::graph_traits<graphs::MeanPayoffGraph>::null_vertex());
-    std::vector<int> current_cost(boost::num_vertices(graph), 0);
-    std::vector<int> current_count(boost::num_vertices(graph), 0);
-    std::queue<graphs::MeanPayoffGraph::vertex_descriptor> t_atr;
-    std::vector<bool> b_atr(boost::num_vertices(graph), false);
-
-    // Map vertex to appropriate index for above vectors and queue
-    std::map<graphs::MeanPayoffGraph::vertex_descriptor, int> vertex_map;
-    std::vector<graphs::MeanPayoffGraph::vertex_descriptor> index_to_vertex(boost::num_vertices(graph));
-
-    const auto [vertices_begin, vertices_end] = boost::vertices(graph);
-    int vertex_count = 0;
-
-    // Initialize vertex mappings and initial state
-    for (const auto &vertex : boost::make_iterator_range(vertices_begin, vertices_end)) {
-        vertex_map[vertex] = vertex_count;
-        index_to_vertex[vertex_count] = vertex;
-        vertex_count++;
-
-        const auto WEIGHT = graph[vertex].weight;
-
-        if (WEIGHT > 0) {
-            t_atr.push(vertex);
-            b_atr[vertex_map[vertex]] = true;
-            limit += WEIGHT;
-        } else {
-            if (graph[vertex].player) {
-                current_count[vertex_map[vertex]] = boost::out_degree(vertex, graph);
-            }
+    // Vertices by index, their successors by index, and the global lifting limit
+    std::map<Vertex, int> vertex_map;
+    std::vector<Vertex> index_to_vertex(n);
+    for (const auto &vertex : boost::make_iterator_range(boost::vertices(graph))) {
+        const int index = static_cast<int>(vertex_map.size());
+        vertex_map[vertex] = index;
+        index_to_vertex[index] = vertex;
+        if (graph[vertex].weight > 0) {
+            limit += graph[vertex].weight;
         }
     }
     limit += 1;
+    std::vector<int> player(n);
+    std::vector<int> weight(n);
+    std::vector<std::vector<int>> successors(n);
+    for (int index = 0; index < n; ++index) {
+        const auto vertex = index_to_vertex[index];
+        player[index] = graph[vertex].player;
+        weight[index] = graph[vertex].weight;
+        for (const auto &edge : boost::make_iterator_range(boost::out_edges(vertex, graph))) {
+            successors[index].push_back(vertex_map[boost::target(edge, graph)]);
+        }
+    }
 
-    // Main solution cycle
-    while (!t_atr.empty()) {
-        iterations++;
-        const auto POS = t_atr.front();
-        t_atr.pop();
-        b_atr[vertex_map[POS]] = false;
-        int old_cost = current_cost[vertex_map[POS]];
-        graphs::MeanPayoffGraph::vertex_descriptor best_successor =
-            boost::graph_traits<graphs::MeanPayoffGraph>::null_vertex();
-
-        if (graph[POS].player) {
-            // Player 1 minimizer
-            const auto [out_edges_begin, out_edges_end] = boost::out_edges(POS, graph);
-            for (const auto &edge : boost::make_iterator_range(out_edges_begin, out_edges_end)) {
-                const auto SUCCESSOR = boost::target(edge, graph);
-                if (best_successor == boost::graph_traits<graphs::MeanPayoffGraph>::null_vertex()) {
-                    best_successor = SUCCESSOR;
-                    current_count[vertex_map[POS]] = 1;
-                } else {
-                    // Compare with current best successor
-                    if (current_cost[vertex_map[best_successor]] > current_cost[vertex_map[SUCCESSOR]]) {
-                        best_successor = SUCCESSOR;
-                        current_count[vertex_map[POS]] = 1;
-                    } else if (current_cost[vertex_map[best_successor]] == current_cost[vertex_map[SUCCESSOR]]) {
-                        current_count[vertex_map[POS]]++;
-                    }
-                }
+    std::vector<int> current_strategy(n, -1);
+    std::vector<int> current_cost = initial_costs;
+    std::vector<int> current_count(n, 0);
+    std::vector<bool> b_atr(n, false);
+
+    // Components sinks first: every component only leads to itself and to solved ones
+    const auto [component, count] = utils::strongly_connected_components(n, [&](int v, auto &&visit) {
+        for (const int w : successors[v]) {
+            visit(w);
+        }
+    });
+    std::vector<std::vector<int>> members(count);
+    std::vector<int> position(n);
+    for (int index = 0; index < n; ++index) {
+        position[index] = static_cast<int>(members[component[index]].size());
+        members[component[index]].push_back(index);
+    }
+    std::vector<std::vector<int>> predecessors(n);
+    for (int index = 0; index < n; ++index) {
+        for (const int successor : successors[index]) {
+            if (component[successor] == component[index]) {
+                predecessors[successor].push_back(index);
             }
+        }
+    }
+
+    for (int c = 0; c < count; ++c) {
+        const auto &scc = members[c];
 
-            if (current_cost[vertex_map[best_successor]] >= limit) {
-                current_count[vertex_map[POS]] = 0;
-                lifts++;
-                current_cost[vertex_map[POS]] = limit;
-            } else {
-                int sum = current_cost[vertex_map[best_successor]] + graph[POS].weight;
-                if (sum >= limit) {
-                    sum = limit;
+        // A finite cost is paid along a simple path through the component and then from a
+        // finite exit, so the component's positive weights plus the largest finite exit
+        // cost bound it; solved exits at the global limit are infinite
+        int local_limit = 0;
+        int exit_cost = 0;
+        for (const int index : scc) {
+            local_limit += std::max(weight[index], 0);
+            for (const int successor : successors[index]) {
+                if (component[successor] != c && current_cost[successor] < limit) {
+                    exit_cost = std::max(exit_cost, current_cost[successor]);
                 }
-                if (current_cost[vertex_map[POS]] < sum) {
-                    lifts++;
-                    current_cost[vertex_map[POS]] = sum;
+            }
+        }
+        local_limit = std::min(local_limit + exit_cost + 1, limit);
+        const auto cost_of = [&](int successor) { return std::min(current_cost[successor], local_limit); };
+
+        // Queue every vertex whose cost can be lifted from the initial costs; for the minimiser,
+        // count the successors that already justify its cost (from all-zero costs, vertices with
+        // positive weight are queued and the others count all successors)
+        std::vector<int> ready;
+        for (const int index : scc) {
+            current_cost[index] = std::min(current_cost[index], local_limit);
+            if (current_cost[index] >= local_limit) {
+                continue;
+            }
+
+            int best = -1;
+            int supporting = 0;
+            for (const int successor : successors[index]) {
+                const int successor_cost = cost_of(successor);
+                const int lifted = successor_cost >= local_limit ? local_limit : std::min(successor_cost + weight[index], local_limit);
+                if (player[index]) {
+                    supporting += lifted <= current_cost[index] ? 1 : 0;
+                } else {
+                    best = std::max(best, lifted);
                 }
             }
+            if (player[index]) {
+                current_count[index] = supporting;
+            }
+            // Dead ends are queued like in a cold start (when their weight is positive)
+            const bool dead_end = successors[index].empty();
+            if (dead_end ? weight[index] > 0 : (player[index] ? supporting == 0 : best > current_cost[index])) {
+                ready.push_back(index);
+                b_atr[index] = true;
+            }
+        }
+
+        if (threads_ > 1 && scc.size() >= parallel_min_vertices) {
+            const auto [parallel_iterations, parallel_lifts] =
+                lift_component_parallel(scc, c, component, position, player, weight, successors, predecessors, local_limit, threads_,
+                                        ready, current_cost, current_strategy, current_count);
+            iterations += parallel_iterations;
+            lifts += parallel_lifts;
         } else {
-            // Player 0 maximizer
-            const auto [out_edges_begin, out_edges_end] = boost::out_edges(POS, graph);
-            for (const auto &edge : boost::make_iterator_range(out_edges_begin, out_edges_end)) {
-                const auto SUCCESSOR = boost::target(edge, graph);
-                if (best_successor == boost::graph_traits<graphs::MeanPayoffGraph>::null_vertex()) {
-                    best_successor = SUCCESSOR;
+            std::queue<int> t_atr(std::deque<int>(ready.begin(), ready.end()));
+
+            // Lift the component with its exits fixed
+            while (!t_atr.empty()) {
+                iterations++;
+                const int POS = t_atr.front();
+                t_atr.pop();
+                b_atr[POS] = false;
+                const int old_cost = current_cost[POS];
+                int best_successor = -1;
+
+                if (player[POS]) {
+                    // Player 1 minimizer
+                    for (const int SUCCESSOR : successors[POS]) {
+                        if (best_successor == -1 || cost_of(best_successor) > cost_of(SUCCESSOR)) {
+                            best_successor = SUCCESSOR;
+                            current_count[POS] = 1;
+                        } else if (cost_of(best_successor) == cost_of(SUCCESSOR)) {
+                            current_count[POS]++;
+                        }
+                    }
+                    // A dead end pays its own weight, as if its successor had cost 0
+                    const int best_cost = best_successor == -1 ? 0 : cost_of(best_successor);
+
+                    if (best_cost >= local_limit) {
+                        current_count[POS] = 0;
+                        lifts++;
+                        current_cost[POS] = local_limit;
+                    } else {
+                        const int sum = std::min(best_cost + weight[POS], local_limit);
+                        if (current_cost[POS] < sum) {
+                            lifts++;
+                            current_cost[POS] = sum;
+                        }
+                    }
                 } else {
-                    if (current_cost[vertex_map[best_successor]] < current_cost[vertex_map[SUCCESSOR]]) {
-                        best_successor = SUCCESSOR;
+                    // Player 0 maximizer
+                    for (const int SUCCESSOR : successors[POS]) {
+                        if (best_successor == -1 || cost_of(best_successor) < cost_of(SUCCESSOR)) {
+                            best_successor = SUCCESSOR;
+                        }
                     }
-                }
-            }
+                    const int best_cost = best_successor == -1 ? 0 : cost_of(best_successor);
 
-            if (current_cost[vertex_map[best_successor]] >= limit) {
-                lifts++;
-                current_cost[vertex_map[POS]] = limit;
-                current_strategy[vertex_map[POS]] = best_successor;
-            } else {
-                int sum = current_cost[vertex_map[best_successor]] + graph[POS].weight;
-                if (sum >= limit) {
-                    sum = limit;
-                }
-                if (current_cost[vertex_map[POS]] < sum) {
-                    lifts++;
-                    current_cost[vertex_map[POS]] = sum;
-                    current_strategy[vertex_map[POS]] = best_successor;
+                    if (best_cost >= local_limit) {
+                        lifts++;
+                        current_cost[POS] = local_limit;
+                        current_strategy[POS] = best_successor;
+                    } else {
+                        const int sum = std::min(best_cost + weight[POS], local_limit);
+                        if (current_cost[POS] < sum) {
+                            lifts++;
+                            current_cost[POS] = sum;
+                            current_strategy[POS] = best_successor;
+                        }
+                    }
                 }
-            }
-        }
 
-        // Process predecessors by manually finding incoming edges
-        const auto [all_vertices_begin, all_vertices_end] = boost::vertices(graph);
-        for (const auto &other_vertex : boost::make_iterator_range(all_vertices_begin, all_vertices_end)) {
-            const auto [out_edges_begin, out_edges_end] = boost::out_edges(other_vertex, graph);
-            for (const auto &edge : boost::make_iterator_range(out_edges_begin, out_edges_end)) {
-                if (boost::target(edge, graph) == POS) {
-                    // Found a predecessor
-                    const auto PREDECESSOR = other_vertex;
-                    if (!b_atr[vertex_map[PREDECESSOR]] &&
-                        (current_cost[vertex_map[PREDECESSOR]] < limit) &&
-                        ((current_cost[vertex_map[POS]] == limit) ||
-                         (current_cost[vertex_map[PREDECESSOR]] <
-                          current_cost[vertex_map[POS]] + graph[PREDECESSOR].weight))) {
-
-                        if (graph[PREDECESSOR].player) {
-                            if (current_cost[vertex_map[PREDECESSOR]] >= old_cost + graph[PREDECESSOR].weight) {
-                                current_count[vertex_map[PREDECESSOR]]--;
+                // Requeue the predecessors in the component that the new cost may lift
+                for (const int PREDECESSOR : predecessors[POS]) {
+                    if (!b_atr[PREDECESSOR] && (current_cost[PREDECESSOR] < local_limit) &&
+                        ((current_cost[POS] == local_limit) ||
+                         (current_cost[PREDECESSOR] < current_cost[POS] + weight[PREDECESSOR]))) {
+
+                        if (player[PREDECESSOR]) {
+                            if (current_cost[PREDECESSOR] >= old_cost + weight[PREDECESSOR]) {
+                                current_count[PREDECESSOR]--;
                             }
-                            if (current_count[vertex_map[PREDECESSOR]] <= 0) {
+                            if (current_count[PREDECESSOR] <= 0) {
                                 t_atr.push(PREDECESSOR);
-                                b_atr[vertex_map[PREDECESSOR]] = true;
+                                b_atr[PREDECESSOR] = true;
                             }
                         } else {
                             t_atr.push(PREDECESSOR);
-                            b_atr[vertex_map[PREDECESSOR]] = true;
+                            b_atr[PREDECESSOR] = true;
                         }
                     }
                 }
             }
         }
+
+        // Infinite costs are reported at the global limit
+        for (const int index : scc) {
+            if (current_cost[index] >= local_limit) {
+                current_cost[index] = limit;
+            }
+        }
     }
 
     // Set the final solution
-    for (const auto &vertex : boost::make_iterator_range(vertices_begin, vertices_end)) {
+    for (int index = 0; index < n; ++index) {
+        const auto vertex = index_to_vertex[index];
         // Set the quantitative value (currentCost as int)
-        solution.set_value(vertex, current_cost[vertex_map[vertex]]);
+        solution.set_value(vertex, current_cost[index]);
+
+        if (!player[index]) {
+            // The maximiser moves to a successor of highest cost, read off the final costs so
+            // that warm starts and parallel lifting report the strategy of a cold solve
+            current_strategy[index] = -1;
+            for (const int SUCCESSOR : successors[index]) {
+                if (current_strategy[index] == -1 || current_cost[SUCCESSOR] > current_cost[current_strategy[index]]) {
+                    current_strategy[index] = SUCCESSOR;
+                }
+            }
+        }
 
-        if (current_cost[vertex_map[vertex]] >= limit) {
+        if (current_cost[index] >= limit) {
             solution.set_winning_player(vertex, 0);
         } else {
             solution.set_winning_player(vertex, 1);
 
-            if (graph[vertex].player) {
-                const auto [out_edges_begin, out_edges_end] = boost::out_edges(vertex, graph);
-                for (const auto &edge : boost::make_iterator_range(out_edges_begin, out_edges_end)) {
-                    const auto SUCCESSOR = boost::target(edge, graph);
-                    if (current_cost[vertex_map[SUCCESSOR]] == 0 ||
-                        current_cost[vertex_map[vertex]] >=
-                            current_cost[vertex_map[SUCCESSOR]] + graph[vertex].weight) {
-                        current_strategy[vertex_map[vertex]] = SUCCESSOR;
+            if (player[index]) {
+                for (const int SUCCESSOR : successors[index]) {
+                    if (current_cost[SUCCESSOR] == 0 || current_cost[index] >= current_cost[SUCCESSOR] + weight[index]) {
+                        current_strategy[index] = SUCCESSOR;
                         break;
                     }
                 }
@@ -190,14 +524,20 @@ RSQSolution<graphs::MeanPayoffGraph, DeterministicStrategy<graphs::MeanPayoffGra
         }
 
         // Only set strategy if it's a valid vertex
-        if (current_strategy[vertex_map[vertex]] != boost::graph_traits<graphs::MeanPayoffGraph>::null_vertex()) {
-            solution.set_strategy(vertex, current_strategy[vertex_map[vertex]]);
+        if (current_strategy[index] != -1) {
+            solution.set_strategy(vertex, index_to_vertex[current_strategy[index]]);
         }
     }
 
     // Game finished, log trace and return solution
-    LGG_TRACE("Solved with ", iterations, " iterations");
+    LGG_TRACE("Solved ", count, " components with ", iterations, " iterations");
     LGG_TRACE("Solved with ", lifts, " lifts");
+    costs_ = std::move(current_cost);
+    owners_ = std::move(player);
+    weights_ = std::move(weight);
+    successors_ = std::move(successors);
+    iterations_ = iterations;
+    lifts_ = lifts;
     solution.set_solved(true);
     return solution;
 }
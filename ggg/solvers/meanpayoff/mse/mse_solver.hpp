@@ -4,6 +4,9 @@
 #include "libggg/solvers/solver.hpp"
 #include <boost/graph/adjacency_list.hpp>
 #include <boost/graph/graph_traits.hpp>
+#include <boost/program_options.hpp>
+#include <stdexcept>
+#include <vector>
 
 namespace ggg {
 namespace solvers {
@@ -15,11 +18,46 @@ namespace solvers {
  * The algorithm transforms the mean payoff game into an energy game and solves it
  * using an iterative approach with progress measures. Provides complete solutions
  * with winning regions, strategies, and quantitative values.
+ *
+ * Strongly connected components are lifted bottom-up, each with the costs of the
+ * components below it fixed and its own limit: the positive weights of the component
+ * plus the largest finite cost it can exit to. Costs that reach that limit are infinite
+ * and are reported at the global limit (sum of positive weights + 1) as before.
+ * With more than one thread, large components are lifted asynchronously in parallel;
+ * the least fixpoint, and so every value and winner, is the same.
  */
 using SolutionType = RSQSolution<graphs::MeanPayoffGraph, DeterministicStrategy<graphs::MeanPayoffGraph>, int>;
 
 class MSESolver : public Solver<graphs::MeanPayoffGraph, SolutionType> {
   public:
+    MSESolver() = default;
+
+    /**
+     * @brief Solver lifting large components with several threads
+     * @param threads Lifting threads (1 lifts sequentially)
+     * @throws std::invalid_argument if threads is below 1
+     */
+    explicit MSESolver(int threads) : threads_(threads) {
+        if (threads < 1) {
+            throw std::invalid_argument("MSE needs at least one thread");
+        }
+    }
+
+    /**
+     * @brief Register the command line options of the solver
+     */
+    static void add_options(boost::program_options::options_description &desc) {
+        desc.add_options()("threads", boost::program_options::value<int>()->default_value(1),
+                           "Lifting threads for components of 512 or more vertices");
+    }
+
+    /**
+     * @brief Create a solver from parsed command line options
+     */
+    static MSESolver from_options(const boost::program_options::variables_map &vm) {
+        return MSESolver(vm["threads"].as<int>());
+    }
+
     /**
      * @brief Solve the mean payoff game using MSE algorithm
      * @param graph Mean payoff graph to solve
@@ -28,6 +66,57 @@ class MSESolver : public Solver<graphs::MeanPayoffGraph, SolutionType> {
      */
     RSQSolution<graphs::MeanPayoffGraph, DeterministicStrategy<graphs::MeanPayoffGraph>, int> solve(const graphs::MeanPayoffGraph &graph) override;
 
+    /**
+     * @brief Solve by lifting from given costs instead of zero
+     *
+     * Lifting reaches the least fixpoint from any costs below it, e.g. the costs of an
+     * earlier solve after vertices moved to the maximiser (player 0).
+     *
+     * @param graph Mean payoff graph to solve
+     * @param initial_costs Costs per vertex index, at most the least fixpoint of graph
+     * @return Complete solution with winning regions, strategies, and quantitative values
+     * @throws std::invalid_argument if there is not one cost per vertex
+     */
+    RSQSolution<graphs::MeanPayoffGraph, DeterministicStrategy<graphs::MeanPayoffGraph>, int> solve(
+        const graphs::MeanPayoffGraph &graph, const std::vector<int> &initial_costs);
+
+    /**
+     * @brief Re-solve after one vertex changed owner since the last solve of this arena
+     *
+     * Costs are monotone in ownership. If the maximiser gained the vertex, lifting
+     * continues from the previous fixpoint; if the minimiser gained it, only the vertices
+     * that can reach it are reset to zero before relifting.
+     *
+     * @param graph The arena of the last solve with the owner of flipped changed
+     * @param flipped Vertex whose owner changed
+     * @return Complete solution with winning regions, strategies, and quantitative values
+     * @throws std::invalid_argument if the last solve was of a different arena (other
+     *         edges, weights, or owners of vertices other than flipped)
+     */
+    RSQSolution<graphs::MeanPayoffGraph, DeterministicStrategy<graphs::MeanPayoffGraph>, int> solve_after_flip(
+        const graphs::MeanPayoffGraph &graph, graphs::MeanPayoffGraph::vertex_descriptor flipped);
+
+    /**
+     * @brief Costs (minimal initial credits, capped at the limit) of the last solve, per vertex index
+     */
+    const std::vector<int> &get_costs() const {
+        return costs_;
+    }
+
+    /**
+     * @brief Number of vertices taken from the work queue in the last solve
+     */
+    int get_iterations() const {
+        return iterations_;
+    }
+
+    /**
+     * @brief Number of cost increases in the last solve
+     */
+    int get_lifts() const {
+        return lifts_;
+    }
+
     /**
      * @brief Get solver name
      * @return Solver description
@@ -35,6 +124,21 @@ class MSESolver : public Solver<graphs::MeanPayoffGraph, SolutionType> {
     std::string get_name() const override {
         return "MSE (Mean payoff Solver using Energy games) Solver";
     }
+
+  private:
+    std::vector<int> costs_;                   ///< Costs of the last solve
+    std::vector<int> owners_;                  ///< Owners in the arena of the last solve, per vertex index
+    std::vector<int> weights_;                 ///< Weights in the arena of the last solve
+    std::vector<std::vector<int>> successors_; ///< Successors in the arena of the last solve
+    int iterations_ = 0;                       ///< Work queue pops of the last solve
+    int lifts_ = 0;                            ///< Cost increases of the last solve
+    int threads_ = 1;                          ///< Lifting threads
+
+    /**
+     * @brief Lift costs from initial_costs to the least fixpoint and extract the solution
+     */
+    RSQSolution<graphs::MeanPayoffGraph, DeterministicStrategy<graphs::MeanPayoffGraph>, int> lift(
+        const graphs::MeanPayoffGraph &graph, const std::vector<int> &initial_costs);
 };
 
 } // namespace solvers
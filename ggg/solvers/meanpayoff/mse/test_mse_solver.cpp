@@ -0,0 +1,227 @@
+#include "libggg/graphs/mean_payoff_graph.hpp"
+#include "random_games.hpp"
+#include <boost/graph/adjacency_list.hpp>
+#include <random>
+#include <string>
+
+#define BOOST_TEST_MODULE MSE Solver Test Suite
+#include <boost/test/unit_test.hpp>
+
+#include "mse_solver.hpp"
+
+using namespace ggg;
+using namespace ggg::graphs;
+using ggg::testing::random_mean_payoff_game;
+
+namespace {
+void check_same_values(const MeanPayoffGraph &graph, const solvers::SolutionType &warm, const solvers::SolutionType &cold) {
+    BOOST_REQUIRE(warm.is_solved());
+    for (const auto vertex : boost::make_iterator_range(boost::vertices(graph))) {
+        BOOST_CHECK_EQUAL(warm.get_value(vertex), cold.get_value(vertex));
+        BOOST_CHECK_EQUAL(warm.get_winning_player(vertex), cold.get_winning_player(vertex));
+        BOOST_CHECK_EQUAL(warm.has_strategy(vertex), cold.has_strategy(vertex));
+        if (warm.has_strategy(vertex) && cold.has_strategy(vertex)) {
+            BOOST_CHECK_EQUAL(warm.get_strategy(vertex), cold.get_strategy(vertex));
+        }
+        // Every maximiser with a move has a strategy
+        BOOST_CHECK(graph[vertex].player || boost::out_degree(vertex, graph) == 0 || warm.has_strategy(vertex));
+    }
+}
+} // namespace
+
+BOOST_AUTO_TEST_SUITE(MSESolverTests)
+
+BOOST_AUTO_TEST_CASE(TestPositiveCycleWins) {
+    // v0 (player 1) chooses between a positive and a negative self-loop
+    MeanPayoffGraph graph;
+    auto v0 = add_vertex(graph, "v0", 1, 0);
+    auto v1 = add_vertex(graph, "v1", 0, 2);
+    auto v2 = add_vertex(graph, "v2", 0, -1);
+    boost::add_edge(v0, v1, graph);
+    boost::add_edge(v0, v2, graph);
+    boost::add_edge(v1, v1, graph);
+    boost::add_edge(v2, v2, graph);
+
+    solvers::MSESolver solver;
+    auto solution = solver.solve(graph);
+    BOOST_CHECK(solution.is_solved());
+    BOOST_CHECK_EQUAL(solution.get_winning_player(v0), 1);
+    BOOST_CHECK_EQUAL(solution.get_winning_player(v1), 0);
+    BOOST_CHECK_EQUAL(solution.get_winning_player(v2), 1);
+
+    // Given to player 0, v0 takes the positive loop
+    graph[v0].player = 0;
+    solution = solver.solve_after_flip(graph, v0);
+    BOOST_CHECK_EQUAL(solution.get_winning_player(v0), 0);
+}
+
+BOOST_AUTO_TEST_CASE(TestSolveAfterFlipMatchesColdSolve) {
+    std::mt19937 rng(17);
+    for (int round = 0; round < 300; ++round) {
+        MeanPayoffGraph graph = random_mean_payoff_game(12, -10, 10, rng);
+        solvers::MSESolver solver;
+        solver.solve(graph);
+
+        // Flips in both directions, chained on the same solver
+        for (int flip = 0; flip < 4; ++flip) {
+            const auto vertex = boost::vertex(rng() % 12, graph);
+            graph[vertex].player = 1 - graph[vertex].player;
+            const auto warm = solver.solve_after_flip(graph, vertex);
+            solvers::MSESolver cold;
+            check_same_values(graph, warm, cold.solve(graph));
+        }
+    }
+}
+
+BOOST_AUTO_TEST_CASE(TestSolveAfterFlipRejectsOtherArenas) {
+    std::mt19937 rng(31);
+    const MeanPayoffGraph graph = random_mean_payoff_game(12, -10, 10, rng);
+    const auto flipped = boost::vertex(4, graph);
+    const auto other = boost::vertex(7, graph);
+    solvers::MSESolver solver;
+    solver.solve(graph);
+
+    // Same number of vertices, but another weight, owner or edge
+    MeanPayoffGraph reweighted = graph;
+    reweighted[other].weight += 1;
+    BOOST_CHECK_THROW(solver.solve_after_flip(reweighted, flipped), std::invalid_argument);
+    MeanPayoffGraph reowned = graph;
+    reowned[other].player = 1 - reowned[other].player;
+    BOOST_CHECK_THROW(solver.solve_after_flip(reowned, flipped), std::invalid_argument);
+    MeanPayoffGraph rewired = graph;
+    boost::add_edge(other, flipped, rewired);
+    BOOST_CHECK_THROW(solver.solve_after_flip(rewired, flipped), std::invalid_argument);
+    BOOST_CHECK_THROW(solver.solve_after_flip(random_mean_payoff_game(12, -10, 10, rng), flipped), std::invalid_argument);
+
+    MeanPayoffGraph flip = graph;
+    flip[flipped].player = 1 - flip[flipped].player;
+    solvers::MSESolver cold;
+    check_same_values(flip, solver.solve_after_flip(flip, flipped), cold.solve(flip));
+}
+
+BOOST_AUTO_TEST_CASE(TestInitialCostsBelowFixpoint) {
+    std::mt19937 rng(3);
+    MeanPayoffGraph graph = random_mean_payoff_game(10, -10, 10, rng);
+    solvers::MSESolver solver;
+    const auto cold = solver.solve(graph);
+    std::vector<int> half = solver.get_costs();
+    for (auto &cost : half) {
+        cost /= 2;
+    }
+    check_same_values(graph, solver.solve(graph, half), cold);
+    BOOST_CHECK_THROW(solver.solve(graph, std::vector<int>(3, 0)), std::invalid_argument);
+}
+
+BOOST_AUTO_TEST_CASE(TestComponentLimitsIgnoreUpstreamWeights) {
+    // v0 (weight 1000) leads into a positive self-loop on v1 and a cycle v2 <-> v3 worth 1
+    MeanPayoffGraph graph;
+    auto v0 = add_vertex(graph, "v0", 1, 1000);
+    auto v1 = add_vertex(graph, "v1", 0, 1);
+    auto v2 = add_vertex(graph, "v2", 1, 2);
+    auto v3 = add_vertex(graph, "v3", 1, -1);
+    boost::add_edge(v0, v1, graph);
+    boost::add_edge(v0, v2, graph);
+    boost::add_edge(v1, v1, graph);
+    boost::add_edge(v2, v3, graph);
+    boost::add_edge(v3, v2, graph);
+
+    solvers::MSESolver solver;
+    auto solution = solver.solve(graph);
+    BOOST_CHECK_EQUAL(solution.get_winning_player(v1), 0);
+    BOOST_CHECK_EQUAL(solution.get_value(v1), 1004);
+    BOOST_CHECK_EQUAL(solution.get_winning_player(v2), 0);
+    BOOST_CHECK_EQUAL(solution.get_winning_player(v3), 0);
+    BOOST_CHECK_EQUAL(solution.get_winning_player(v0), 0);
+    // Lifting v1 alone to the global limit would take over a thousand lifts
+    BOOST_CHECK_LE(solver.get_lifts(), 20);
+}
+
+BOOST_AUTO_TEST_CASE(TestCostsAreAFixpoint) {
+    // On games with many components, every finite cost is max(0, weight + best successor cost)
+    std::mt19937 rng(41);
+    for (int round = 0; round < 100; ++round) {
+        MeanPayoffGraph graph = random_mean_payoff_game(30, -10, 10, rng);
+        int limit = 1;
+        for (const auto vertex : boost::make_iterator_range(boost::vertices(graph))) {
+            limit += std::max(graph[vertex].weight, 0);
+        }
+        solvers::MSESolver solver;
+        const auto solution = solver.solve(graph);
+        const auto &costs = solver.get_costs();
+        for (const auto vertex : boost::make_iterator_range(boost::vertices(graph))) {
+            int best = graph[vertex].player ? limit : 0;
+            for (const auto &edge : boost::make_iterator_range(boost::out_edges(vertex, graph))) {
+                const int successor = costs[boost::target(edge, graph)];
+                best = graph[vertex].player ? std::min(best, successor) : std::max(best, successor);
+            }
+            const int expected = best >= limit ? limit : std::min(std::max(0, best + graph[vertex].weight), limit);
+            BOOST_CHECK_EQUAL(costs[vertex], expected);
+            BOOST_CHECK_EQUAL(solution.get_winning_player(vertex), costs[vertex] >= limit ? 0 : 1);
+        }
+    }
+}
+
+BOOST_AUTO_TEST_CASE(TestDeadEnds) {
+    // Dead ends of either player pay their own weight (at least 0) and stop
+    MeanPayoffGraph graph;
+    auto v0 = add_vertex(graph, "v0", 0, 3);
+    auto v1 = add_vertex(graph, "v1", 1, 2);
+    auto v2 = add_vertex(graph, "v2", 1, -1);
+    auto v3 = add_vertex(graph, "v3", 0, 0);
+    auto v4 = add_vertex(graph, "v4", 1, 1);
+    boost::add_edge(v3, v0, graph);
+    boost::add_edge(v3, v1, graph);
+    boost::add_edge(v4, v0, graph);
+    boost::add_edge(v4, v1, graph);
+
+    solvers::MSESolver solver;
+    const auto solution = solver.solve(graph);
+    BOOST_CHECK((solver.get_costs() == std::vector<int>{3, 2, 0, 3, 3}));
+    // A dead end with negative weight needs no credit and has no move
+    BOOST_CHECK_EQUAL(solution.get_value(v2), 0);
+    BOOST_CHECK(!solution.has_strategy(v2));
+    for (const auto vertex : boost::make_iterator_range(boost::vertices(graph))) {
+        BOOST_CHECK_EQUAL(solution.get_winning_player(vertex), 1);
+    }
+
+    // Dead ends in random games, sequentially, in parallel and after flips
+    std::mt19937 rng(59);
+    for (int round = 0; round < 6; ++round) {
+        MeanPayoffGraph random = random_mean_payoff_game(round < 3 ? 30 : 1500, -10, 10, rng, {0, 3});
+        solvers::MSESolver sequential;
+        const auto expected = sequential.solve(random);
+        for (const auto vertex : boost::make_iterator_range(boost::vertices(random))) {
+            if (boost::out_degree(vertex, random) == 0) {
+                BOOST_CHECK_EQUAL(sequential.get_costs()[vertex], std::max(random[vertex].weight, 0));
+            }
+        }
+        solvers::MSESolver parallel(3);
+        check_same_values(random, parallel.solve(random), expected);
+
+        const auto vertex = boost::vertex(rng() % boost::num_vertices(random), random);
+        random[vertex].player = 1 - random[vertex].player;
+        solvers::MSESolver cold;
+        check_same_values(random, sequential.solve_after_flip(random, vertex), cold.solve(random));
+    }
+}
+
+BOOST_AUTO_TEST_CASE(TestParallelLiftingMatchesSequential) {
+    std::mt19937 rng(23);
+    for (int round = 0; round < 12; ++round) {
+        // One giant component, lifted in parallel (components of 512 or more vertices)
+        MeanPayoffGraph graph = random_mean_payoff_game(1500, -10, 10, rng);
+        solvers::MSESolver sequential;
+        const auto expected = sequential.solve(graph);
+        solvers::MSESolver parallel(2 + round % 3);
+        check_same_values(graph, parallel.solve(graph), expected);
+        BOOST_CHECK(parallel.get_costs() == sequential.get_costs());
+
+        const auto vertex = boost::vertex(rng() % 1500, graph);
+        graph[vertex].player = 1 - graph[vertex].player;
+        solvers::MSESolver cold;
+        check_same_values(graph, parallel.solve_after_flip(graph, vertex), cold.solve(graph));
+    }
+    BOOST_CHECK_THROW(solvers::MSESolver(0), std::invalid_argument);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
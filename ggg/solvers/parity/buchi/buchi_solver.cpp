@@ -1,4 +1,5 @@
 #include "buchi_solver.hpp"
+#include "libggg/solvers/bitboard.hpp"
 #include "libggg/graphs/player_utilities.hpp"
 #include "libggg/graphs/priority_utilities.hpp"
 #include "libggg/utils/logging.hpp"
@@ -11,11 +12,49 @@
 
 namespace ggg::solvers {
 
+namespace {
+
+/**
+ * @brief Solve a tiny Buchi game on bitmasks
+ *
+ * Strategies follow the generic path: a successor inside the owner's winning region,
+ * or the first successor if there is none.
+ */
+template <typename Mask>
+RSSolution<graphs::ParityGraph> solve_bitboard(const graphs::ParityGraph &graph) {
+    RSSolution<graphs::ParityGraph> solution;
+    const auto arena = bitboard::make_arena<Mask>(graph);
+    const Mask player0_winning_region = bitboard::solve_buchi(arena, arena.player1);
+
+    for (int v = 0; v < arena.num_vertices; ++v) {
+        const int winner = (player0_winning_region & bitboard::bit<Mask>(v)) ? 0 : 1;
+        solution.set_winning_player(v, winner);
+
+        const int owner = (arena.player1 & bitboard::bit<Mask>(v)) ? 1 : 0;
+        const Mask successors = arena.successors[v];
+        if (owner != winner || !successors) {
+            continue;
+        }
+        const Mask winning_region = winner == 0 ? player0_winning_region : arena.vertices & ~player0_winning_region;
+        const Mask staying = successors & winning_region;
+        solution.set_strategy(v, bitboard::lowest_bit(staying ? staying : successors));
+    }
+
+    solution.set_solved(true);
+    return solution;
+}
+
+} // namespace
+
 RSSolution<graphs::ParityGraph> BuchiSolver::solve(const graphs::ParityGraph &graph) {
 
     LGG_DEBUG("Buchi solver starting with ", boost::num_vertices(graph), " vertices");
     RSSolution<graphs::ParityGraph> solution;
 
+    // Reset counters, so that no path reports the statistics of an earlier solve
+    iterations = 0;
+    attractions = 0;
+
     // Validate input
     if (!validate_buchi_game(graph)) {
         LGG_ERROR("Invalid Buchi game: priorities must be 0 or 1"); // TODO swap current parity validation with buchi one
@@ -30,9 +69,13 @@ RSSolution<graphs::ParityGraph> BuchiSolver::solve(const graphs::ParityGraph &gr
         return solution;
     }
 
-    // Reset counters
-    iterations = 0;
-    attractions = 0;
+    // Arenas of at most 128 vertices are solved on machine words
+    if (bitboard::with_mask_for(boost::num_vertices(graph), [&](auto mask) {
+            solution = solve_bitboard<decltype(mask)>(graph);
+        })) {
+        LGG_DEBUG("Buchi game solved on bitboard");
+        return solution;
+    }
 
     // Get all vertices and Buchi accepting vertices (priority 1)
     const auto [vertices_begin, vertices_end] = boost::vertices(graph);
@@ -79,8 +79,8 @@ class BuchiSolver : public Solver<graphs::ParityGraph, RSSolution<graphs::Parity
                                                       const std::set<graphs::ParityVertex> &inactive_vertices) const;
 
     // Statistic fields
-    uint iterations;  // Total number of iterations for the game solution
-    uint attractions; // Total number of vertex attractions for the game solution
+    uint iterations = 0;  // Total number of iterations for the game solution
+    uint attractions = 0; // Total number of vertex attractions for the game solution
 };
 
 } // namespace ggg::solvers
@@ -1,6 +1,7 @@
 #include "priority_promotion_solver.hpp"
 #include "libggg/graphs/graph_utilities.hpp"
 #include "libggg/graphs/player_utilities.hpp"
+#include "libggg/solvers/parity_kernels.hpp"
 #include <algorithm>
 #include <cassert>
 #include <iostream>
@@ -19,6 +20,15 @@ PriorityPromotionSolver::Solution PriorityPromotionSolver::solve(const Graph &gr
         return solution;
     }
 
+    // Games with at most four compressed priorities have specialised kernels
+    parity_kernels::Result result;
+    if (kernels_ && parity_kernels::with_levels_for(graphs::priority_utilities::get_compressed_priority_count(graph), [&](auto levels) {
+            result = parity_kernels::solve_levels<decltype(levels)::value>(parity_kernels::make_arena(graph));
+        })) {
+        parity_kernels::to_solution(result, solution);
+        return solution;
+    }
+
     // Initialize algorithm state
     initialize(graph);
     build_adjacency_cache(graph);
@@ -123,26 +133,6 @@ PriorityPromotionSolver::Solution PriorityPromotionSolver::solve(const Graph &gr
         }
     }
 
-    // Transfer strategies from internal representation to solution
-    // Only set strategies for vertices owned by the same player who wins them
-    const auto [VERTICES_BEGIN2, VERTICES_END2] = boost::vertices(graph);
-    for (auto it = VERTICES_BEGIN2; it != VERTICES_END2; ++it) {
-        Vertex v = *it;
-        // Only set strategy if:
-        // 1. Vertex was solved (disabled)
-        // 2. Vertex has a strategy from the algorithm
-        // 3. Vertex owner matches the winning player
-        if (is_disabled(v) && has_strategy(v)) {
-            int vertex_owner = get_player(v);
-            int winning_player = solution.get_winning_player(v);
-
-            // Only set strategy if the vertex owner is the same as the winning player
-            if (vertex_owner == winning_player) {
-                solution.set_strategy(v, get_strategy(v));
-            }
-        }
-    }
-
     LGG_TRACE("Solved with ", iterations, " iterations");
     LGG_TRACE("Solved with ", totpromos, " promotions");
     LGG_TRACE("Solved with ", doms, " dominions");
@@ -399,7 +389,14 @@ void PriorityPromotionSolver::set_dominion(int priority, Solution &solution) {
         disabled_[v] = true;
     }
 
-    // Step 4: Set strategies from attractor computation
+    // Step 4: Set strategies of the region, where the player's vertices keep the move that
+    // attracted them, then from attractor computation. Strategies are only taken here, as
+    // vertices attracted in step 2 may still hold a move from an earlier, abandoned region
+    for (Vertex v : dominion_core) {
+        if (get_player(v) == PLAYER && has_strategy(v) && dominion_core.count(get_strategy(v))) {
+            solution.set_strategy(v, get_strategy(v));
+        }
+    }
     // Only set strategies for vertices owned by the winning player
     for (const auto &[from, to] : strategy_map) {
         int vertex_owner = get_player(from);
@@ -3,6 +3,7 @@
 #include "libggg/graphs/parity_graph.hpp"
 #include "libggg/graphs/priority_utilities.hpp"
 #include "libggg/solvers/solver.hpp"
+#include <boost/program_options.hpp>
 #include <queue>
 #include <unordered_map>
 #include <unordered_set>
@@ -22,6 +23,10 @@ namespace ggg::solvers {
  * regions of vertices and promoting them to higher priorities when regions become
  * closed. When a region becomes a dominion, all vertices in it are solved.
  *
+ * Games whose priorities compress to at most four values (such as reachability and
+ * Büchi games) are handed to the specialised kernels of parity_kernels.hpp instead,
+ * unless the solver is constructed (or run with --no-kernels) to always promote.
+ *
  * Time complexity: Exponential in worst case, but often efficient in practice.
  * Space complexity: O(n) where n is the number of vertices.
  *
@@ -37,6 +42,28 @@ class PriorityPromotionSolver : public Solver<graphs::ParityGraph, RSSolution<gr
     using Graph = graphs::ParityGraph;
     using Solution = RSSolution<graphs::ParityGraph>;
 
+    PriorityPromotionSolver() = default;
+
+    /**
+     * @brief Solver that may or may not hand few-priority games to the specialised kernels
+     * @param kernels Whether games with at most four compressed priorities go to the kernels
+     */
+    explicit PriorityPromotionSolver(bool kernels) : kernels_(kernels) {}
+
+    /**
+     * @brief Register the command line options of the solver
+     */
+    static void add_options(boost::program_options::options_description &desc) {
+        desc.add_options()("no-kernels", "Run priority promotion also on games with at most four compressed priorities");
+    }
+
+    /**
+     * @brief Create a solver from parsed command line options
+     */
+    static PriorityPromotionSolver from_options(const boost::program_options::variables_map &vm) {
+        return PriorityPromotionSolver(vm.count("no-kernels") == 0);
+    }
+
     /**
      * @brief Solve the parity game using priority promotion algorithm
      * @param graph Parity graph to solve
@@ -62,6 +89,7 @@ class PriorityPromotionSolver : public Solver<graphs::ParityGraph, RSSolution<gr
     // Algorithm state
     int max_priority_;
     int promotions_;
+    bool kernels_ = true; // Hand few-priority games to the specialised kernels
 
     // Vertex mappings - using maps for safe vertex ID handling
     std::map<Vertex, int> region_;        // vertex -> current priority/region
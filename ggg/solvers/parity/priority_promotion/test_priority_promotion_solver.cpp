@@ -0,0 +1,85 @@
+#include "libggg/graphs/parity_graph.hpp"
+#include "libggg/solvers/parity_kernels.hpp"
+#include "random_games.hpp"
+#include <boost/graph/adjacency_list.hpp>
+#include <random>
+#include <string>
+
+#define BOOST_TEST_MODULE Priority Promotion Solver Test Suite
+#include <boost/test/unit_test.hpp>
+
+#include "priority_promotion_solver.hpp"
+
+using namespace ggg;
+using namespace ggg::graphs;
+using ggg::testing::random_parity_game;
+
+namespace {
+/**
+ * @brief Check winners against the specialised kernels, and that every vertex whose owner
+ *        wins it has a move along an edge staying in the winning region
+ */
+void check_solution(const ParityGraph &graph, const solvers::RSSolution<ParityGraph> &solution) {
+    BOOST_REQUIRE(solution.is_solved());
+    solvers::parity_kernels::Result expected;
+    BOOST_REQUIRE(solvers::parity_kernels::solve(graph, expected));
+    for (const auto vertex : boost::make_iterator_range(boost::vertices(graph))) {
+        const int winner = solution.get_winning_player(vertex);
+        BOOST_CHECK_EQUAL(winner, expected.winner[vertex]);
+        const auto move = solution.get_strategy(vertex);
+        if (graph[vertex].player != winner) {
+            BOOST_CHECK(move == boost::graph_traits<ParityGraph>::null_vertex());
+            continue;
+        }
+        BOOST_REQUIRE(move != boost::graph_traits<ParityGraph>::null_vertex());
+        BOOST_CHECK(boost::edge(vertex, move, graph).second);
+        BOOST_CHECK_EQUAL(solution.get_winning_player(move), winner);
+    }
+}
+} // namespace
+
+BOOST_AUTO_TEST_SUITE(PriorityPromotionTests)
+
+BOOST_AUTO_TEST_CASE(TestSimpleGame) {
+    // v0 (player 1) chooses between an even and an odd self-loop
+    ParityGraph graph;
+    auto v0 = add_vertex(graph, "v0", 1, 1);
+    auto v1 = add_vertex(graph, "v1", 0, 2);
+    auto v2 = add_vertex(graph, "v2", 0, 1);
+    boost::add_edge(v0, v1, graph);
+    boost::add_edge(v0, v2, graph);
+    boost::add_edge(v1, v1, graph);
+    boost::add_edge(v2, v2, graph);
+
+    solvers::PriorityPromotionSolver solver(false);
+    const auto solution = solver.solve(graph);
+    BOOST_CHECK(solution.is_solved());
+    BOOST_CHECK_EQUAL(solution.get_winning_player(v0), 1);
+    BOOST_CHECK_EQUAL(solution.get_winning_player(v1), 0);
+    BOOST_CHECK_EQUAL(solution.get_winning_player(v2), 1);
+    BOOST_CHECK(solution.get_strategy(v0) == v2);
+}
+
+BOOST_AUTO_TEST_CASE(TestPromotionMatchesKernels) {
+    // Without the kernels, priority promotion runs on every game
+    std::mt19937 rng(13);
+    for (int round = 0; round < 300; ++round) {
+        const int n = 4 + round % 40;
+        const ParityGraph graph = random_parity_game(n, 0, 1 + round % 9, rng);
+        solvers::PriorityPromotionSolver solver(false);
+        check_solution(graph, solver.solve(graph));
+    }
+}
+
+BOOST_AUTO_TEST_CASE(TestFewPrioritiesUseKernels) {
+    std::mt19937 rng(29);
+    for (int round = 0; round < 50; ++round) {
+        const ParityGraph graph = random_parity_game(30, 0, round % 2 ? 1 : 3, rng);
+        solvers::PriorityPromotionSolver kernels;
+        solvers::PriorityPromotionSolver promotion(false);
+        check_solution(graph, kernels.solve(graph));
+        check_solution(graph, promotion.solve(graph));
+    }
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -3,6 +3,8 @@
 #include <boost/graph/graph_traits.hpp>
 #include <cassert>
 #include <queue>
+#include <stdexcept>
+#include <string>
 #include <vector>
 
 namespace ggg {
@@ -17,6 +19,31 @@ RSSolution<graphs::ParityGraph> ProgressiveSmallProgressMeasuresSolver::solve(co
         pms[i] = 0;
     }
 
+    return run();
+}
+
+RSSolution<graphs::ParityGraph> ProgressiveSmallProgressMeasuresSolver::solve(const graphs::ParityGraph &graph,
+                                                                              const std::vector<int> &initial_measures,
+                                                                              int player) {
+    init(graph);
+    if (initial_measures.size() != pms.size()) {
+        throw std::invalid_argument("Initial progress measures have " + std::to_string(initial_measures.size()) +
+                                    " values, expected " + std::to_string(pms.size()));
+    }
+    if (player != 0 && player != 1) {
+        throw std::invalid_argument("Warm-start player must be 0 or 1");
+    }
+
+    // Keep the given player's components (indices of its parity, including its Top flag);
+    // the opponent's measures restart from the bottom element
+    for (int i = 0; i < static_cast<int>(pms.size()); i++) {
+        pms[i] = (i % k) % 2 == player ? initial_measures[i] : 0;
+    }
+
+    return run();
+}
+
+RSSolution<graphs::ParityGraph> ProgressiveSmallProgressMeasuresSolver::run() {
     // Initialize all strategies to undefined (-1)
     for (int i = 0; i < boost::num_vertices(*pv); i++) {
         strategy[i] = -1;
@@ -33,6 +60,13 @@ RSSolution<graphs::ParityGraph> ProgressiveSmallProgressMeasuresSolver::solve(co
         auto vertex = *vertex_it;
         int node = vertex_to_node(*pv, vertex);
         counts[(*pv)[vertex].priority]++;
+
+        // Vertices already Top for the player of their priority's parity no longer bound
+        // that player's measures (as if they had been lifted to Top in this run)
+        const int priority = (*pv)[vertex].priority;
+        if (pms[k * node + (priority & 1)] == -1) {
+            counts[priority]--;
+        }
     }
 
     // Initialize dirty flags to clean state
@@ -402,7 +436,8 @@ void ProgressiveSmallProgressMeasuresSolver::update(int pl) {
                     if (unstable[m])
                         continue; // Already marked unstable
 
-                    // For opponent nodes, check if all stable successors force instability
+                    // An opponent node stays stable if a stable successor still justifies its
+                    // measure; a node of player pl becomes unstable with any of its successors
                     if ((*pv)[other_vertex].player != pl) {
                         int best_to = -1;
                         const int d = (*pv)[other_vertex].priority;
@@ -425,35 +460,30 @@ void ProgressiveSmallProgressMeasuresSolver::update(int pl) {
                             }
                         }
 
-                        if (best_to == -1)
-                            continue; // No stable successors
-
-                        // If current measure is not worse than best stable successor,
-                        // this node doesn't become unstable
-                        if (pm_less(pms.data() + k * m, best.data(), d, pl))
+                        // Current measure not below the best stable successor: stays stable
+                        if (best_to != -1 && !pm_less(pms.data() + k * m, best.data(), d, pl))
                             continue;
-
-                        // Mark as unstable and add to queue
-                        unstable[m] = 1;
-                        q.push(m);
                     }
+
+                    // Mark as unstable and add to queue
+                    unstable[m] = 1;
+                    q.push(m);
                 }
             }
         }
     }
 
     // Phase 3: Set measures to Top for stable nodes of the opponent
-    // If a node is stable for player pl but has finite measure for opponent,
-    // and its priority doesn't favor the opponent, set opponent's measure to Top
+    // The opponent can keep player pl in the stable nodes, where pl's measures cannot
+    // rise, so the opponent wins them; its own priorities there no longer bound its measures
     for (int i = 0; i < boost::num_vertices(*pv); i++) {
         if (unstable[i] == 0 && pms[k * i + 1 - pl] != -1) {
             auto vertex = node_to_vertex(*pv, i);
             if (((*pv)[vertex].priority & 1) != pl) {
-                // Priority doesn't favor player pl, so opponent can't win from here
                 counts[(*pv)[vertex].priority]--;
-                pms[k * i + 1 - pl] = -1;
-                todo_push(i); // Schedule for further processing
             }
+            pms[k * i + 1 - pl] = -1;
+            todo_push(i); // Schedule for further processing
         }
     }
 }
@@ -39,6 +39,41 @@ class ProgressiveSmallProgressMeasuresSolver : public Solver<graphs::ParityGraph
      */
     RSSolution<graphs::ParityGraph> solve(const graphs::ParityGraph &graph) override;
 
+    /**
+     * @brief Solve starting from the measures of an earlier solve of the same arena
+     *
+     * Lifting reaches the least fixpoint from any measures below it, so one player's
+     * final measures can seed the next solve whenever the new game can only raise them:
+     * after vertices change owner towards that player (owning more vertices never lowers
+     * a player's least fixpoint). The opponent's measures restart from the bottom element.
+     * Vertex priorities must be unchanged.
+     *
+     * @param graph The parity graph to solve
+     * @param initial_measures Measures returned by get_measures() after the earlier solve
+     * @param player Player whose measures are reused (0 or 1)
+     * @return RSSolution containing winning regions and optimal strategies for both players
+     * @throws std::invalid_argument if the measures do not fit the graph or player is not 0 or 1
+     */
+    RSSolution<graphs::ParityGraph> solve(const graphs::ParityGraph &graph, const std::vector<int> &initial_measures,
+                                          int player);
+
+    /**
+     * @brief Progress measures of the last solve
+     *
+     * Per vertex, k = (max priority + 1, at least 2) values; index i belongs to the player
+     * of parity i, and index 0 (resp. 1) is -1 when player 0's (resp. 1's) measure is Top.
+     */
+    const std::vector<int> &get_measures() const {
+        return pms;
+    }
+
+    /**
+     * @brief Number of lift operations (successful or not) in the last solve
+     */
+    int64_t get_lift_attempts() const {
+        return lift_count + lift_attempt;
+    }
+
     /**
      * @brief Get solver name for identification
      * @return Human-readable solver description
@@ -62,6 +97,11 @@ class ProgressiveSmallProgressMeasuresSolver : public Solver<graphs::ParityGraph
     int64_t lift_count;            ///< Count of successful lift operations
     int64_t lift_attempt;          ///< Count of attempted lift operations
 
+    /**
+     * @brief Run the lifting phases from the measures in pms and extract the solution
+     */
+    RSSolution<graphs::ParityGraph> run();
+
     /**
      * @brief Initialize algorithm data structures for the given game
      * @param game The parity graph to solve
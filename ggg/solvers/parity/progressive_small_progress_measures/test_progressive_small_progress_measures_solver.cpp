@@ -0,0 +1,99 @@
+#include "libggg/graphs/parity_graph.hpp"
+#include "random_games.hpp"
+#include <boost/graph/adjacency_list.hpp>
+#include <random>
+#include <string>
+
+#define BOOST_TEST_MODULE Progressive Small Progress Measures Solver Test Suite
+#include <boost/test/unit_test.hpp>
+
+#include "progressive_small_progress_measures_solver.hpp"
+
+using namespace ggg;
+using namespace ggg::graphs;
+using ggg::testing::random_parity_game;
+
+namespace {
+/**
+ * @brief Check a warm-started solution against a cold one, both of which must be certified
+ */
+void check_same_winners(const ParityGraph &graph, const solvers::RSSolution<ParityGraph> &warm,
+                        const solvers::RSSolution<ParityGraph> &cold) {
+    BOOST_REQUIRE(cold.is_solved());
+    BOOST_REQUIRE(warm.is_solved());
+    for (const auto vertex : boost::make_iterator_range(boost::vertices(graph))) {
+        BOOST_CHECK_EQUAL(warm.get_winning_player(vertex), cold.get_winning_player(vertex));
+    }
+}
+} // namespace
+
+BOOST_AUTO_TEST_SUITE(ProgressiveSmallProgressMeasuresTests)
+
+BOOST_AUTO_TEST_CASE(TestSimpleGame) {
+    solvers::ProgressiveSmallProgressMeasuresSolver solver;
+    ParityGraph graph;
+    auto v0 = add_vertex(graph, "v0", 1, 1);
+    auto v1 = add_vertex(graph, "v1", 0, 2);
+    auto v2 = add_vertex(graph, "v2", 0, 1);
+    boost::add_edge(v0, v1, graph);
+    boost::add_edge(v0, v2, graph);
+    boost::add_edge(v1, v1, graph);
+    boost::add_edge(v2, v2, graph);
+
+    auto solution = solver.solve(graph);
+    BOOST_CHECK(solution.is_solved());
+    BOOST_CHECK_EQUAL(solution.get_winning_player(v0), 1);
+    BOOST_CHECK_EQUAL(solution.get_winning_player(v1), 0);
+    BOOST_CHECK_EQUAL(solution.get_winning_player(v2), 1);
+}
+
+BOOST_AUTO_TEST_CASE(TestWarmStartAfterOwnerFlip) {
+    std::mt19937 rng(11);
+    for (int round = 0; round < 200; ++round) {
+        ParityGraph graph = random_parity_game(12, 0, 4, rng);
+        solvers::ProgressiveSmallProgressMeasuresSolver solver;
+        solver.solve(graph);
+        const auto measures = solver.get_measures();
+
+        // The player gaining the vertex keeps its measures
+        const auto vertex = boost::vertex(rng() % 12, graph);
+        const int gainer = 1 - graph[vertex].player;
+        graph[vertex].player = gainer;
+
+        solvers::ProgressiveSmallProgressMeasuresSolver cold;
+        check_same_winners(graph, solver.solve(graph, measures, gainer), cold.solve(graph));
+    }
+}
+
+BOOST_AUTO_TEST_CASE(TestGrayCodeChain) {
+    // Every ownership of 8 vertices, one flip at a time, each solve seeded by the previous one
+    std::mt19937 rng(5);
+    ParityGraph graph = random_parity_game(8, 0, 5, rng);
+    for (const auto vertex : boost::make_iterator_range(boost::vertices(graph))) {
+        graph[vertex].player = 0;
+    }
+    solvers::ProgressiveSmallProgressMeasuresSolver warm;
+    solvers::ProgressiveSmallProgressMeasuresSolver cold;
+    warm.solve(graph);
+    int64_t warm_lifts = warm.get_lift_attempts();
+    int64_t cold_lifts = warm_lifts;
+    for (unsigned step = 1; step < 256; ++step) {
+        const auto vertex = boost::vertex(__builtin_ctz(step), graph);
+        graph[vertex].player = 1 - graph[vertex].player;
+        const auto measures = warm.get_measures();
+        const auto warm_solution = warm.solve(graph, measures, graph[vertex].player);
+        check_same_winners(graph, warm_solution, cold.solve(graph));
+        warm_lifts += warm.get_lift_attempts();
+        cold_lifts += cold.get_lift_attempts();
+    }
+    BOOST_CHECK_LT(warm_lifts, cold_lifts);
+}
+
+BOOST_AUTO_TEST_CASE(TestMismatchedMeasuresThrow) {
+    std::mt19937 rng(2);
+    const ParityGraph graph = random_parity_game(5, 0, 2, rng);
+    solvers::ProgressiveSmallProgressMeasuresSolver solver;
+    BOOST_CHECK_THROW(solver.solve(graph, std::vector<int>(3, 0), 0), std::invalid_argument);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
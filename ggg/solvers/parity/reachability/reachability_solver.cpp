@@ -1,14 +1,51 @@
 #include "reachability_solver.hpp"
+#include "libggg/solvers/bitboard.hpp"
 #include "libggg/utils/logging.hpp"
 #include <boost/graph/adjacency_list.hpp>
 #include <boost/graph/graph_traits.hpp>
 #include <algorithm>
-#include <queue>
-#include <set>
 
 namespace ggg {
 namespace solvers {
 
+namespace {
+
+/**
+ * @brief Solve a tiny reachability game on bitmasks
+ *
+ * Produces the same regions as the generic path and the same moves for player 1 (the
+ * first out-edge in adjacency order). Player 0 gets attracting moves in the attractor,
+ * but not necessarily the ones the generic path's worklist order picks.
+ */
+template <typename Mask>
+RSSolution<graphs::ParityGraph> solve_bitboard(const graphs::ParityGraph &graph) {
+    RSSolution<graphs::ParityGraph> solution;
+    const auto arena = bitboard::make_arena<Mask>(graph);
+    const Mask targets = arena.with_priority(1);
+
+    std::array<int, bitboard::capacity<Mask>> strategy;
+    strategy.fill(-1);
+    const Mask player0_winning_region = targets ? bitboard::solve_reachability(arena, arena.player1, strategy.data()) : Mask(0);
+
+    for (int v = 0; v < arena.num_vertices; ++v) {
+        const bool player0_wins = player0_winning_region & bitboard::bit<Mask>(v);
+        solution.set_winning_player(v, player0_wins ? 0 : 1);
+        if (!targets || (targets & bitboard::bit<Mask>(v))) {
+            continue;
+        }
+        if (strategy[v] >= 0) {
+            solution.set_strategy(v, strategy[v]);
+        } else if ((arena.player1 & bitboard::bit<Mask>(v)) && arena.successors[v]) {
+            solution.set_strategy(v, *boost::adjacent_vertices(v, graph).first);
+        }
+    }
+
+    solution.set_solved(true);
+    return solution;
+}
+
+} // namespace
+
 RSSolution<graphs::ParityGraph> ReachabilitySolver::solve(const graphs::ParityGraph &graph) {
     LGG_DEBUG("Reachability solver starting with ", boost::num_vertices(graph), " vertices");
     RSSolution<graphs::ParityGraph> solution;
@@ -27,155 +64,206 @@ RSSolution<graphs::ParityGraph> ReachabilitySolver::solve(const graphs::ParityGr
         return solution;
     }
 
-    // Get all vertices and target vertices (priority 1)
-    const auto [vertices_begin, vertices_end] = boost::vertices(graph);
-    const std::set<graphs::ParityVertex> all_vertices(vertices_begin, vertices_end);
-    const auto target_vertices = get_target_vertices(graph);
-
-    LGG_TRACE("Found ", TARGET_VERTICES.size(), " target vertices (priority 1)");
-
-    // Special case: no target vertices means Player 1 wins everywhere
-    if (target_vertices.empty()) {
-        LGG_DEBUG("No target vertices found - Player 1 wins all vertices");
-        for (const auto &vertex : all_vertices) {
-            solution.set_winning_player(vertex, 1);
-        }
-        solution.set_solved(true);
+    // Arenas of at most 128 vertices are solved on machine words
+    if (bitboard::with_mask_for(boost::num_vertices(graph), [&](auto mask) {
+            solution = solve_bitboard<decltype(mask)>(graph);
+        })) {
+        LGG_DEBUG("Reachability game solved on bitboard");
         return solution;
     }
 
-    // Algorithm for reachability games:
-    // Compute Attr₀(TARGET_VERTICES) - the attractor of Player 0 to target vertices
-    // Player 0 wins all vertices in this attractor, Player 1 wins the rest
-    const auto [player0_winning_region, player0_strategy] = compute_attractor(graph, target_vertices, 0);
-
-    LGG_TRACE("Player 0 attractor computed: ", player0_winning_region.size(), " vertices");
+    return solve_cached(graph);
+}
 
-    // Set winning regions
-    for (const auto &vertex : player0_winning_region) {
-        solution.set_winning_player(vertex, 0);
+RSSolution<graphs::ParityGraph> ReachabilitySolver::solve_cached(const graphs::ParityGraph &graph) {
+    RSSolution<graphs::ParityGraph> solution;
+    const bool rebuilt = cache_arena(graph);
+    const int n = cached_vertices_;
+    if (attracted_.size() < static_cast<std::size_t>(n)) {
+        attracted_.resize(n, 0);
+        counted_.resize(n, 0);
+        remaining_.resize(n);
+        move_.resize(n);
+    }
+    if (++epoch_ == 0) {
+        // Stamps wrapped around: forget every slot once
+        std::fill(attracted_.begin(), attracted_.end(), 0);
+        std::fill(counted_.begin(), counted_.end(), 0);
+        epoch_ = 1;
     }
 
-    for (const auto &vertex : all_vertices) {
-        if (player0_winning_region.find(vertex) == player0_winning_region.end()) {
-            solution.set_winning_player(vertex, 1);
+    // Targets (priority 1); the core is recomputed when they or the edges change
+    worklist_.clear();
+    for (int v = 0; v < n; ++v) {
+        if (graph[v].priority == 1) {
+            worklist_.push_back(v);
         }
     }
-
-    // Set strategies from attractor computation
-    for (const auto &[from, to] : player0_strategy) {
-        solution.set_strategy(from, to);
+    if (rebuilt || worklist_ != targets_) {
+        targets_ = worklist_;
+        cache_core();
     }
-
-    // For Player 1 vertices outside the attractor, any strategy works (they win anyway)
-    for (const auto &vertex : all_vertices) {
-        if (player0_winning_region.find(vertex) == player0_winning_region.end() &&
-            graph[vertex].player == 1) {
-            const auto [out_begin, out_end] = boost::out_edges(vertex, graph);
-            if (out_begin != out_end) {
-                solution.set_strategy(vertex, boost::target(*out_begin, graph));
+    const bool targets = !targets_.empty();
+
+    // Attractor of player 0, seeded with the core: core vertices outside the target move
+    // along their first edge, which stays in the core, boundary vertices of player 0
+    // along their edge into it, and player 1 boundary vertices count the rest
+    worklist_.clear();
+    for (const int v : core_) {
+        attracted_[v] = epoch_;
+        move_[v] = graph[v].player == 0 && graph[v].priority != 1 ? successors_[successor_offsets_[v]] : -1;
+    }
+    for (std::size_t i = 0; i < boundary_.size(); ++i) {
+        const int v = boundary_[i];
+        if (graph[v].player == 0) {
+            attracted_[v] = epoch_;
+            move_[v] = boundary_exit_[i];
+            worklist_.push_back(v);
+        } else {
+            counted_[v] = epoch_;
+            remaining_[v] = core_remaining_[v];
+        }
+    }
+    for (std::size_t i = 0; i < worklist_.size(); ++i) {
+        const int current = worklist_[i];
+        for (int p = predecessor_offsets_[current]; p < predecessor_offsets_[current + 1]; ++p) {
+            const int predecessor = predecessors_[p];
+            if (attracted_[predecessor] == epoch_) {
+                continue;
+            }
+            if (graph[predecessor].player == 0) {
+                move_[predecessor] = current;
+            } else {
+                // Opponent vertex: add only once all outgoing edges lead to the attractor
+                if (counted_[predecessor] != epoch_) {
+                    counted_[predecessor] = epoch_;
+                    remaining_[predecessor] = successor_offsets_[predecessor + 1] - successor_offsets_[predecessor];
+                }
+                if (--remaining_[predecessor] > 0) {
+                    continue;
+                }
+                move_[predecessor] = -1;
             }
+            attracted_[predecessor] = epoch_;
+            worklist_.push_back(predecessor);
         }
     }
 
+    // Attracting moves for player 0, the first out-edge for player 1 (none without targets)
+    std::size_t player0_wins = 0;
+    for (int v = 0; v < n; ++v) {
+        const bool attracted = attracted_[v] == epoch_;
+        solution.set_winning_player(v, attracted ? 0 : 1);
+        player0_wins += attracted;
+        if (attracted && move_[v] >= 0) {
+            solution.set_strategy(v, move_[v]);
+        } else if (targets && graph[v].player == 1 && graph[v].priority != 1 &&
+                   successor_offsets_[v] < successor_offsets_[v + 1]) {
+            solution.set_strategy(v, successors_[successor_offsets_[v]]);
+        }
+    }
     solution.set_solved(true);
 
-    LGG_DEBUG("Reachability game solved: Player 0 wins ", player0_winning_region.size(),
-              " vertices, Player 1 wins ", (all_vertices.size() - player0_winning_region.size()), " vertices");
+    LGG_DEBUG("Reachability game solved: Player 0 wins ", player0_wins, " vertices, Player 1 wins ",
+              (n - player0_wins), " vertices");
 
     return solution;
 }
 
-bool ReachabilitySolver::validate_reachability_game(const graphs::ParityGraph &graph) const {
-    const auto [vertices_begin, vertices_end] = boost::vertices(graph);
-    return std::all_of(vertices_begin, vertices_end, [&graph](const auto &vertex) {
-        int priority = graph[vertex].priority;
-        return priority == 0 || priority == 1;
-    });
-}
-
-std::pair<std::set<graphs::ParityVertex>, std::map<graphs::ParityVertex, graphs::ParityVertex>>
-ReachabilitySolver::compute_attractor(const graphs::ParityGraph &graph,
-                                      const std::set<graphs::ParityVertex> &target,
-                                      int player) const {
-    std::set<graphs::ParityVertex> attractor = target;
-    std::map<graphs::ParityVertex, graphs::ParityVertex> strategy;
-    std::queue<graphs::ParityVertex> worklist;
-
-    // Pre-compute incoming edges for efficient predecessor lookup
-    std::map<graphs::ParityVertex, std::vector<graphs::ParityVertex>> in_edges;
-    std::map<graphs::ParityVertex, int> remaining_out_degree;
-
-    const auto [vertices_begin, vertices_end] = boost::vertices(graph);
-
-    // Build incoming edge map and initialize out-degree counters
-    for (const auto &vertex : boost::make_iterator_range(vertices_begin, vertices_end)) {
-        remaining_out_degree[vertex] = boost::out_degree(vertex, graph);
-
-        const auto [out_begin, out_end] = boost::out_edges(vertex, graph);
+bool ReachabilitySolver::cache_arena(const graphs::ParityGraph &graph) {
+    const int n = static_cast<int>(boost::num_vertices(graph));
+    bool unchanged = n == cached_vertices_ && static_cast<int>(boost::num_edges(graph)) == static_cast<int>(successors_.size());
+    for (int v = 0; unchanged && v < n; ++v) {
+        int s = successor_offsets_[v];
+        const auto [out_begin, out_end] = boost::out_edges(v, graph);
         for (const auto &edge : boost::make_iterator_range(out_begin, out_end)) {
-            const auto target_vertex = boost::target(edge, graph);
-            in_edges[target_vertex].push_back(vertex);
+            if (s == successor_offsets_[v + 1] || successors_[s] != static_cast<int>(boost::target(edge, graph))) {
+                unchanged = false;
+                break;
+            }
+            ++s;
         }
+        unchanged = unchanged && s == successor_offsets_[v + 1];
     }
-
-    // Initialize worklist with target vertices
-    for (const auto &vertex : target) {
-        worklist.push(vertex);
+    if (unchanged) {
+        return false;
     }
 
-    // Compute attractor using backward reachability
-    while (!worklist.empty()) {
-        const auto current = worklist.front();
-        worklist.pop();
-
-        // Process all predecessors of current vertex
-        for (const auto &predecessor : in_edges[current]) {
-            // Skip if predecessor is already in attractor
-            if (attractor.count(predecessor)) {
-                continue;
-            }
+    LGG_TRACE("Rebuilding cached arena of ", n, " vertices");
+    cached_vertices_ = n;
+    successor_offsets_.assign(n + 1, 0);
+    predecessor_offsets_.assign(n + 1, 0);
+    successors_.clear();
+    for (int v = 0; v < n; ++v) {
+        const auto [out_begin, out_end] = boost::out_edges(v, graph);
+        for (const auto &edge : boost::make_iterator_range(out_begin, out_end)) {
+            const int w = static_cast<int>(boost::target(edge, graph));
+            successors_.push_back(w);
+            predecessor_offsets_[w + 1]++;
+        }
+        successor_offsets_[v + 1] = static_cast<int>(successors_.size());
+    }
+    for (int v = 0; v < n; ++v) {
+        predecessor_offsets_[v + 1] += predecessor_offsets_[v];
+    }
+    predecessors_.resize(successors_.size());
+    std::vector<int> position(predecessor_offsets_.begin(), predecessor_offsets_.end() - 1);
+    for (int v = 0; v < n; ++v) {
+        for (int s = successor_offsets_[v]; s < successor_offsets_[v + 1]; ++s) {
+            predecessors_[position[successors_[s]]++] = v;
+        }
+    }
+    return true;
+}
 
-            bool should_add = false;
+void ReachabilitySolver::cache_core() {
+    const int n = cached_vertices_;
+    LGG_TRACE("Computing attractor core of ", targets_.size(), " targets");
+    in_core_.assign(n, 0);
+    core_remaining_.resize(n);
+    for (int v = 0; v < n; ++v) {
+        core_remaining_[v] = successor_offsets_[v + 1] - successor_offsets_[v];
+    }
+    core_ = targets_;
+    for (const int v : targets_) {
+        in_core_[v] = 1;
+    }
 
-            if (graph[predecessor].player == player) {
-                // Player vertex: add if it has an edge to attractor
-                should_add = true;
-                strategy[predecessor] = current;
-            } else {
-                // Opponent vertex: add only if all outgoing edges lead to attractor
-                remaining_out_degree[predecessor]--;
-                if (remaining_out_degree[predecessor] == 0) {
-                    should_add = true;
-                    // For opponent vertices, any successor in attractor works as strategy
-                    const auto [out_begin, out_end] = boost::out_edges(predecessor, graph);
-                    if (out_begin != out_end) {
-                        strategy[predecessor] = boost::target(*out_begin, graph);
-                    }
-                }
+    // A vertex joins once all of its successors are in the core, whoever owns it
+    for (std::size_t i = 0; i < core_.size(); ++i) {
+        const int current = core_[i];
+        for (int p = predecessor_offsets_[current]; p < predecessor_offsets_[current + 1]; ++p) {
+            const int predecessor = predecessors_[p];
+            if (!in_core_[predecessor] && --core_remaining_[predecessor] == 0) {
+                in_core_[predecessor] = 1;
+                core_.push_back(predecessor);
             }
+        }
+    }
 
-            if (should_add) {
-                attractor.insert(predecessor);
-                worklist.push(predecessor);
+    // Vertices left outside with an edge into the core, where every attractor resumes
+    boundary_.clear();
+    boundary_exit_.clear();
+    for (int v = 0; v < n; ++v) {
+        if (in_core_[v]) {
+            continue;
+        }
+        for (int s = successor_offsets_[v]; s < successor_offsets_[v + 1]; ++s) {
+            if (in_core_[successors_[s]]) {
+                boundary_.push_back(v);
+                boundary_exit_.push_back(successors_[s]);
+                break;
             }
         }
     }
-
-    return {attractor, strategy};
 }
 
-std::set<graphs::ParityVertex> ReachabilitySolver::get_target_vertices(const graphs::ParityGraph &graph) const {
-    std::set<graphs::ParityVertex> target_vertices;
+bool ReachabilitySolver::validate_reachability_game(const graphs::ParityGraph &graph) const {
     const auto [vertices_begin, vertices_end] = boost::vertices(graph);
-
-    for (const auto &vertex : boost::make_iterator_range(vertices_begin, vertices_end)) {
-        if (graph[vertex].priority == 1) {
-            target_vertices.insert(vertex);
-        }
-    }
-
-    return target_vertices;
+    return std::all_of(vertices_begin, vertices_end, [&graph](const auto &vertex) {
+        int priority = graph[vertex].priority;
+        return priority == 0 || priority == 1;
+    });
 }
 
 } // namespace solvers
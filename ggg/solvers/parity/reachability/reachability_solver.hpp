@@ -2,7 +2,8 @@
 
 #include "libggg/graphs/parity_graph.hpp"
 #include "libggg/solvers/solver.hpp"
-#include <set>
+#include <cstdint>
+#include <vector>
 
 namespace ggg {
 namespace solvers {
@@ -21,6 +22,16 @@ namespace solvers {
  * - We compute the attractor set for Player 0 to all target vertices
  * - Vertices in the attractor are won by Player 0, all others by Player 1
  *
+ * Arenas of at most 128 vertices are solved on bitboards. Larger ones use arrays kept
+ * across solves and sized to the largest graph seen: the successor and predecessor
+ * lists are rebuilt only when the edges change, and per-vertex slots are stamped with
+ * the solve they belong to, so back-to-back solves (e.g. of many ownerships of one
+ * arena) neither allocate nor clear anything.
+ *
+ * Cached with the arena and its targets is the ownership-independent core of the
+ * attractor: the least fixpoint containing the targets where a vertex joins once all
+ * of its successors have, whoever owns it. Every solve starts from the core and its
+ * successor counts instead of from the bare targets.
  */
 class ReachabilitySolver : public Solver<graphs::ParityGraph, RSSolution<graphs::ParityGraph>> {
   public:
@@ -41,30 +52,57 @@ class ReachabilitySolver : public Solver<graphs::ParityGraph, RSSolution<graphs:
 
   private:
     /**
-     * @brief Validate that the graph represents a valid reachability game
-     * @param graph The game graph to validate
-     * @return True if valid reachability game (priorities are 0 or 1)
+     * @brief Solve on the reusable arrays (graph must be non-empty and valid)
      */
-    bool validate_reachability_game(const graphs::ParityGraph &graph) const;
+    RSSolution<graphs::ParityGraph> solve_cached(const graphs::ParityGraph &graph);
 
     /**
-     * @brief Compute attractor set for a player to a target set
-     * @param graph The game graph
-     * @param target Target vertex set
-     * @param player Player computing attractor (0 or 1)
-     * @return Attractor set and strategy mapping
+     * @brief Make the cached successor and predecessor lists those of the graph
+     * @return True if the lists were rebuilt
+     *
+     * Compares the graph's edges with the cached successor lists and rebuilds both lists
+     * only if they differ; owners and priorities are not part of the cache. The comparison
+     * reads every edge because a ParityGraph carries no revision: a graph at the same
+     * address with the same counts (one rebuilt in a loop, or rewired in place) may have
+     * other edges. It is a single allocation-free pass, no more than the solve itself
+     * reads in the worst case, where a rebuild allocates and scatters both lists.
      */
-    std::pair<std::set<graphs::ParityVertex>, std::map<graphs::ParityVertex, graphs::ParityVertex>>
-    compute_attractor(const graphs::ParityGraph &graph,
-                      const std::set<graphs::ParityVertex> &target,
-                      int player) const;
+    bool cache_arena(const graphs::ParityGraph &graph);
 
     /**
-     * @brief Get all target vertices (vertices with priority 1)
-     * @param graph The game graph
-     * @return Set of vertices with priority 1 (target vertices)
+     * @brief Compute the attractor core of targets_ on the cached arena
      */
-    std::set<graphs::ParityVertex> get_target_vertices(const graphs::ParityGraph &graph) const;
+    void cache_core();
+
+    // Arena cache, kept while consecutive graphs have the same edges
+    int cached_vertices_ = -1;
+    std::vector<int> successor_offsets_;
+    std::vector<int> successors_;
+    std::vector<int> predecessor_offsets_;
+    std::vector<int> predecessors_;
+
+    // Core cache, kept while the arena and its targets stay the same
+    std::vector<int> targets_;        ///< Target vertices (priority 1)
+    std::vector<int> core_;           ///< Core vertices, targets first
+    std::vector<char> in_core_;       ///< Membership in the core
+    std::vector<int> core_remaining_; ///< Successors outside the core
+    std::vector<int> boundary_;       ///< Vertices outside the core with a successor in it
+    std::vector<int> boundary_exit_;  ///< First such successor of every boundary vertex
+
+    // Per-vertex slots; a slot is only valid in the solve whose epoch_ it carries
+    std::uint32_t epoch_ = 0;
+    std::vector<std::uint32_t> attracted_; ///< Epoch in which the vertex joined the attractor
+    std::vector<std::uint32_t> counted_;   ///< Epoch in which remaining_ was initialised
+    std::vector<int> remaining_;           ///< Successors not yet in the attractor
+    std::vector<int> move_;                ///< Attracting successor of attracted player 0 vertices
+    std::vector<int> worklist_;
+
+    /**
+     * @brief Validate that the graph represents a valid reachability game
+     * @param graph The game graph to validate
+     * @return True if valid reachability game (priorities are 0 or 1)
+     */
+    bool validate_reachability_game(const graphs::ParityGraph &graph) const;
 };
 
 } // namespace solvers
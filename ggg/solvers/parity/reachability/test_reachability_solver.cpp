@@ -1,5 +1,8 @@
 #include "libggg/graphs/parity_graph.hpp"
+#include "libggg/graphs/player_utilities.hpp"
 #include <boost/graph/adjacency_list.hpp>
+#include <random>
+#include <set>
 
 #define BOOST_TEST_MODULE Reachability Solver Test Suite
 #include <boost/test/unit_test.hpp>
@@ -110,6 +113,81 @@ BOOST_AUTO_TEST_CASE(TestNoTargetVertices) {
     BOOST_CHECK_EQUAL(solution.get_winning_player(v1), 1);
 }
 
+BOOST_AUTO_TEST_CASE(TestBackToBackSolvesMatchAttractor) {
+    // One solver across ownership changes of one arena and across different arenas
+    solvers::ReachabilitySolver solver;
+    std::mt19937 rng(3);
+    for (int arena = 0; arena < 4; ++arena) {
+        const int n = 200 + 150 * (arena % 2);
+        ParityGraph graph;
+        for (int v = 0; v < n; ++v) {
+            add_vertex(graph, "v" + std::to_string(v), 0, rng() % 10 == 0 ? 1 : 0);
+        }
+        for (int v = 0; v < n; ++v) {
+            std::set<int> successors;
+            for (int e = 0, degree = 1 + static_cast<int>(rng() % 3); e < degree; ++e) {
+                successors.insert(static_cast<int>(rng() % n));
+            }
+            for (const int w : successors) {
+                boost::add_edge(v, w, graph);
+            }
+        }
+
+        for (int round = 0; round < 6; ++round) {
+            for (int v = 0; v < n; ++v) {
+                graph[v].player = static_cast<int>(rng() % 2);
+            }
+            if (round == 3) {
+                // Another target set on the same edges recomputes the cached core
+                const int v = static_cast<int>(rng() % n);
+                graph[v].priority = 1 - graph[v].priority;
+            }
+            std::set<ParityVertex> targets;
+            for (int v = 0; v < n; ++v) {
+                if (graph[v].priority == 1) {
+                    targets.insert(v);
+                }
+            }
+            const auto expected = graphs::player_utilities::compute_attractor(graph, targets, 0).first;
+            const auto solution = solver.solve(graph);
+            BOOST_REQUIRE(solution.is_solved());
+            for (int v = 0; v < n; ++v) {
+                const int winner = solution.get_winning_player(v);
+                BOOST_CHECK_EQUAL(winner, expected.count(v) ? 0 : 1);
+                const auto move = solution.get_strategy(v);
+                if (graph[v].player == 0 && winner == 0 && graph[v].priority == 0) {
+                    BOOST_REQUIRE(move != boost::graph_traits<ParityGraph>::null_vertex());
+                    BOOST_CHECK(boost::edge(v, move, graph).second);
+                    BOOST_CHECK(expected.count(move));
+                }
+            }
+        }
+    }
+}
+
+BOOST_AUTO_TEST_CASE(TestPlayer1TakesFirstOutEdge) {
+    // Small arenas (solved on bitboards) and large ones give player 1 its first out-edge
+    solvers::ReachabilitySolver solver;
+    std::mt19937 rng(7);
+    for (const int n : {40, 300}) {
+        ParityGraph graph;
+        for (int v = 0; v < n; ++v) {
+            add_vertex(graph, "v" + std::to_string(v), static_cast<int>(rng() % 2), rng() % 8 == 0 ? 1 : 0);
+        }
+        for (int v = 0; v < n; ++v) {
+            for (int e = 0, degree = 1 + static_cast<int>(rng() % 3); e < degree; ++e) {
+                boost::add_edge(v, rng() % n, graph);
+            }
+        }
+        const auto solution = solver.solve(graph);
+        for (int v = 0; v < n; ++v) {
+            if (graph[v].player == 1 && graph[v].priority == 0) {
+                BOOST_CHECK(solution.get_strategy(v) == *boost::adjacent_vertices(v, graph).first);
+            }
+        }
+    }
+}
+
 BOOST_AUTO_TEST_CASE(TestSolverName) {
     solvers::ReachabilitySolver solver;
     std::string name = solver.get_name();
@@ -1,6 +1,7 @@
 #include "recursive_solver.hpp"
 #include "libggg/graphs/player_utilities.hpp"
 #include "libggg/graphs/priority_utilities.hpp"
+#include "libggg/solvers/parity_kernels.hpp"
 #include "libggg/utils/logging.hpp"
 #include <boost/graph/adjacency_list.hpp>
 #include <boost/graph/graph_traits.hpp>
@@ -13,6 +14,7 @@ namespace solvers {
 RecursiveParitySolver::RecursiveParitySolver()
     : max_recursion_depth_(0), // 0 means unlimited
       enable_statistics_(true),
+      kernels_(true),
       current_depth_(0),
       max_reached_depth_(0),
       subgames_created_(0) {
@@ -21,9 +23,10 @@ RecursiveParitySolver::RecursiveParitySolver()
     vertex_mapping_.clear();
 }
 
-RecursiveParitySolver::RecursiveParitySolver(size_t max_depth)
+RecursiveParitySolver::RecursiveParitySolver(size_t max_depth, bool kernels)
     : max_recursion_depth_(max_depth),
       enable_statistics_(true),
+      kernels_(kernels),
       current_depth_(0),
       max_reached_depth_(0),
       subgames_created_(0) {
@@ -43,7 +46,19 @@ void RecursiveParitySolver::reset_solve_state() {
 RecursiveParitySolution RecursiveParitySolver::solve(const graphs::ParityGraph &graph) {
     reset_solve_state();
     LGG_TRACE("Starting recursive solve with ", boost::num_vertices(graph), " vertices");
-    auto solution = solve_internal(graph, 0);
+
+    // Arenas of at most 128 vertices are solved on machine words, games with at most
+    // four compressed priorities by the unrolled kernels; a depth limit is enforced by
+    // the recursion itself as it descends
+    RecursiveParitySolution solution;
+    parity_kernels::Result result;
+    if (kernels_ && max_recursion_depth_ == 0 && parity_kernels::solve(graph, result)) {
+        parity_kernels::to_solution(result, solution);
+        max_reached_depth_ = result.statistics.max_depth;
+        subgames_created_ = result.statistics.subgames;
+    } else {
+        solution = solve_internal(graph, 0);
+    }
 
     // Set the statistics in the solution
     solution.set_max_depth_reached(max_reached_depth_);
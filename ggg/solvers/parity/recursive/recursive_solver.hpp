@@ -3,6 +3,7 @@
 #include "libggg/graphs/parity_graph.hpp"
 #include "libggg/solvers/solver.hpp"
 #include <boost/graph/graph_traits.hpp>
+#include <boost/program_options.hpp>
 #include <map>
 #include <set>
 
@@ -63,6 +64,10 @@ class RecursiveParitySolution : public RSSolution<graphs::ParityGraph> {
  * 2. Computing the attractor set for that priority's player
  * 3. Recursively solving the remaining subgame
  * 4. Propagating results back
+ * Arenas of at most 128 vertices and games whose priorities compress to at most four
+ * values run on the specialised kernels of parity_kernels.hpp, which unroll the
+ * recursion on priorities at compile time, unless the solver is constructed (or run
+ * with --no-kernels) to always recurse or has a recursion depth limit to enforce.
  * @complexity Time: O(2^n), Space: O(nc) where n = vertices and c = max colour
  */
 class RecursiveParitySolver : public Solver<graphs::ParityGraph, RecursiveParitySolution> {
@@ -74,9 +79,25 @@ class RecursiveParitySolver : public Solver<graphs::ParityGraph, RecursiveParity
 
     /**
      * @brief Constructor with recursion depth limit
-     * @param max_depth Maximum recursion depth (0 for unlimited)
+     * @param max_depth Maximum recursion depth (0 for unlimited; a limit disables the kernels)
+     * @param kernels Whether small and few-priority games go to the specialised kernels
      */
-    explicit RecursiveParitySolver(size_t max_depth);
+    explicit RecursiveParitySolver(size_t max_depth, bool kernels = true);
+
+    /**
+     * @brief Register the command line options of the solver
+     */
+    static void add_options(boost::program_options::options_description &desc) {
+        desc.add_options()("no-kernels", "Recurse also on games the specialised kernels would solve");
+    }
+
+    /**
+     * @brief Create a solver from parsed command line options
+     */
+    static RecursiveParitySolver from_options(const boost::program_options::variables_map &vm) {
+        return RecursiveParitySolver(0, vm.count("no-kernels") == 0);
+    }
+
     /**
      * @brief Solve the parity game recursively
      * @param graph Parity graph to solve
@@ -101,6 +122,7 @@ class RecursiveParitySolver : public Solver<graphs::ParityGraph, RecursiveParity
     // Configuration members initialized in constructor
     size_t max_recursion_depth_; ///< Maximum allowed recursion depth (0 = unlimited)
     bool enable_statistics_;     ///< Whether to collect solver statistics
+    bool kernels_;               ///< Whether the specialised kernels may solve the game
 
     // Runtime state members (reset for each top-level solve call)
     size_t current_depth_;     ///< Current recursion depth
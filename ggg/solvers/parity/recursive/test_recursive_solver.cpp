@@ -0,0 +1,94 @@
+#include "libggg/graphs/parity_graph.hpp"
+#include "libggg/solvers/parity_kernels.hpp"
+#include "random_games.hpp"
+#include <boost/graph/adjacency_list.hpp>
+#include <random>
+#include <stdexcept>
+#include <string>
+
+#define BOOST_TEST_MODULE Recursive Solver Test Suite
+#include <boost/test/unit_test.hpp>
+
+#include "recursive_solver.hpp"
+
+using namespace ggg;
+using namespace ggg::graphs;
+using ggg::testing::random_parity_game;
+
+namespace {
+/**
+ * @brief Check winners against the specialised kernels, and that every vertex whose owner
+ *        wins it has a move along an edge staying in the winning region
+ */
+void check_solution(const ParityGraph &graph, const solvers::RecursiveParitySolution &solution) {
+    BOOST_REQUIRE(solution.is_solved());
+    solvers::parity_kernels::Result expected;
+    BOOST_REQUIRE(solvers::parity_kernels::solve(graph, expected));
+    for (const auto vertex : boost::make_iterator_range(boost::vertices(graph))) {
+        const int winner = solution.get_winning_player(vertex);
+        BOOST_CHECK_EQUAL(winner, expected.winner[vertex]);
+        if (graph[vertex].player != winner) {
+            continue;
+        }
+        const auto move = solution.get_strategy(vertex);
+        BOOST_REQUIRE(move != boost::graph_traits<ParityGraph>::null_vertex());
+        BOOST_CHECK(boost::edge(vertex, move, graph).second);
+        BOOST_CHECK_EQUAL(solution.get_winning_player(move), winner);
+    }
+}
+} // namespace
+
+BOOST_AUTO_TEST_SUITE(RecursiveSolverTests)
+
+BOOST_AUTO_TEST_CASE(TestSimpleGame) {
+    // v0 (player 1) chooses between an even and an odd self-loop
+    ParityGraph graph;
+    auto v0 = add_vertex(graph, "v0", 1, 1);
+    auto v1 = add_vertex(graph, "v1", 0, 2);
+    auto v2 = add_vertex(graph, "v2", 0, 1);
+    boost::add_edge(v0, v1, graph);
+    boost::add_edge(v0, v2, graph);
+    boost::add_edge(v1, v1, graph);
+    boost::add_edge(v2, v2, graph);
+
+    solvers::RecursiveParitySolver solver(0, false);
+    const auto solution = solver.solve(graph);
+    BOOST_CHECK(solution.is_solved());
+    BOOST_CHECK_EQUAL(solution.get_winning_player(v0), 1);
+    BOOST_CHECK_EQUAL(solution.get_winning_player(v1), 0);
+    BOOST_CHECK_EQUAL(solution.get_winning_player(v2), 1);
+    BOOST_CHECK(solution.get_strategy(v0) == v2);
+    BOOST_CHECK_GT(solution.get_subgames_created(), 0u);
+}
+
+BOOST_AUTO_TEST_CASE(TestRecursionMatchesKernels) {
+    // Without the kernels, the recursion runs on every game
+    std::mt19937 rng(13);
+    for (int round = 0; round < 200; ++round) {
+        const int n = 4 + round % 40;
+        const ParityGraph graph = random_parity_game(n, 0, 1 + round % 9, rng);
+        solvers::RecursiveParitySolver kernels;
+        solvers::RecursiveParitySolver recursion(0, false);
+        const auto solution = recursion.solve(graph);
+        check_solution(graph, solution);
+        check_solution(graph, kernels.solve(graph));
+    }
+}
+
+BOOST_AUTO_TEST_CASE(TestDepthLimitRecurses) {
+    // A depth limit is enforced by the recursion as it descends, even on small games
+    std::mt19937 rng(5);
+    const ParityGraph graph = random_parity_game(30, 0, 8, rng);
+    solvers::RecursiveParitySolver unlimited(0, false);
+    const auto solution = unlimited.solve(graph);
+    const auto depth = solution.get_max_depth_reached();
+    BOOST_REQUIRE_GT(depth, 0u);
+
+    solvers::RecursiveParitySolver shallow(depth);
+    BOOST_CHECK_THROW(shallow.solve(graph), std::runtime_error);
+    solvers::RecursiveParitySolver deep(depth + 1);
+    check_solution(graph, deep.solve(graph));
+    BOOST_CHECK_EQUAL(deep.solve(graph).get_max_depth_reached(), depth);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
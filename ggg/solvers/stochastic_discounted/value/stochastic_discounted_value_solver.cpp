@@ -1,8 +1,11 @@
 #include "stochastic_discounted_value_solver.hpp"
 #include "libggg/utils/logging.hpp"
 #include <boost/graph/graph_utility.hpp>
+#include <chrono>
 #include <map>
 #include <random>
+#include <set>
+#include <vector>
 
 namespace ggg::solvers {
 
@@ -43,6 +46,16 @@ auto StochasticDiscountedValueSolver::solve(const graphs::Stochastic_DiscountedG
         BAtr[vertex] = true;
     }
 
+    statistics_ = ValueIterationStatistics();
+    if (options_.method != ValueIterationMethod::Worklist) {
+        iterate_compressed(graph);
+        TAtr.clear();
+        if (!statistics_.converged) {
+            LGG_WARN("Value iteration stopped after ", statistics_.sweeps, " sweeps with residual ", statistics_.residual);
+        }
+    }
+    const auto iteration_start = std::chrono::steady_clock::now();
+
     // Main improvement loop
     int pos;
     int best_succ;
@@ -84,13 +97,23 @@ auto StochasticDiscountedValueSolver::solve(const graphs::Stochastic_DiscountedG
             sol[pos] = best;
             strategy[pos] = best_succ;
 
-            // Propagate change to all predecessors
-            for (auto pred : boost::make_iterator_range(boost::vertices(graph))) {
-                for (auto e : boost::make_iterator_range(boost::out_edges(pred, graph))) {
-                    if (boost::target(e, graph) == pos) {
-                        if (!BAtr[pred]) {
-                            TAtr.push(pred);
-                            BAtr[pred] = true;
+            // Propagate change to all predecessors, passing through probabilistic vertices
+            std::vector<int> changed{pos};
+            std::set<int> seen{pos};
+            while (!changed.empty()) {
+                const int current = changed.back();
+                changed.pop_back();
+                for (auto pred : boost::make_iterator_range(boost::vertices(graph))) {
+                    for (auto e : boost::make_iterator_range(boost::out_edges(pred, graph))) {
+                        if (boost::target(e, graph) == static_cast<unsigned>(current)) {
+                            if (graph[pred].player == -1) {
+                                if (seen.insert(pred).second) {
+                                    changed.push_back(pred);
+                                }
+                            } else if (!BAtr[pred]) {
+                                TAtr.push(pred);
+                                BAtr[pred] = true;
+                            }
                         }
                     }
                 }
@@ -98,6 +121,11 @@ auto StochasticDiscountedValueSolver::solve(const graphs::Stochastic_DiscountedG
         }
     }
 
+    if (options_.method == ValueIterationMethod::Worklist) {
+        statistics_.updates = iterations;
+        statistics_.time_ms = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - iteration_start).count();
+    }
+
     // Set solution results
     for (const auto &vertex : boost::make_iterator_range(vertices_begin, vertices_end)) {
         if (sol[vertex] >= 0) {
@@ -111,8 +139,42 @@ auto StochasticDiscountedValueSolver::solve(const graphs::Stochastic_DiscountedG
 
     LGG_TRACE("Solved with ", iterations, " iterations");
     LGG_TRACE("Solved with ", lifts, " lifts");
-    solution.set_solved(true);
+    solution.set_solved(statistics_.converged);
     return solution;
 }
 
+BellmanSystem StochasticDiscountedValueSolver::make_system(const graphs::Stochastic_DiscountedGraph &graph) {
+    // Probabilistic vertices get no choices and keep value 0, like in the worklist method
+    const int num_vertices = boost::num_vertices(graph);
+    BellmanSystem system(num_vertices);
+    for (const auto &vertex : boost::make_iterator_range(boost::vertices(graph))) {
+        if (graph[vertex].player != -1) {
+            system.player[vertex] = graph[vertex].player;
+            for (const auto &gedge : boost::make_iterator_range(boost::out_edges(vertex, graph))) {
+                const auto SUCCESSOR = boost::target(gedge, graph);
+                const auto CURRE = edge(vertex, SUCCESSOR, graph);
+                system.add_choice(SUCCESSOR, graph[CURRE.first].weight);
+                for (const auto &[TARGET, PROB] : graphs::get_reachable_through_probabilistic(graph, vertex, SUCCESSOR)) {
+                    system.add_term(TARGET, PROB * graph[CURRE.first].discount);
+                }
+            }
+        }
+        system.end_vertex();
+    }
+    return system;
+}
+
+void StochasticDiscountedValueSolver::iterate_compressed(const graphs::Stochastic_DiscountedGraph &graph) {
+    const int num_vertices = boost::num_vertices(graph);
+    const BellmanSystem system = make_system(graph);
+    std::vector<double> values(num_vertices, 0.0);
+    statistics_ = iterate_values(system, options_, values);
+    for (const auto &vertex : graphs::get_non_probabilistic_vertices(graph)) {
+        double best = 0.0;
+        const int choice = system.best_choice(vertex, values, best);
+        sol[vertex] = values[vertex];
+        strategy[vertex] = choice < 0 ? -1 : system.choice_successor[choice];
+    }
+}
+
 } // namespace ggg::solvers
\ No newline at end of file
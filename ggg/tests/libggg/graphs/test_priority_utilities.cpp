@@ -191,6 +191,26 @@ BOOST_AUTO_TEST_CASE(TestPriorityCompression) {
     }
 }
 
+BOOST_AUTO_TEST_CASE(TestCompressedPriorityCount) {
+    TestGraph graph;
+    BOOST_CHECK_EQUAL(get_compressed_priority_count(graph), 0);
+
+    // {3, 5} collapse into one odd priority, 8 and 10 into one even priority
+    add_vertex(graph, "v1", 3, 1.0);
+    add_vertex(graph, "v2", 5, 2.0);
+    BOOST_CHECK_EQUAL(get_compressed_priority_count(graph), 1);
+    add_vertex(graph, "v3", 8, 3.0);
+    add_vertex(graph, "v4", 10, 4.0);
+    BOOST_CHECK_EQUAL(get_compressed_priority_count(graph), 2);
+    add_vertex(graph, "v5", 13, 5.0);
+    BOOST_CHECK_EQUAL(get_compressed_priority_count(graph), 3);
+
+    // Agrees with the number of distinct priorities after compression
+    const int count = get_compressed_priority_count(graph);
+    compress_priorities(graph);
+    BOOST_CHECK_EQUAL(static_cast<int>(get_unique_priorities(graph).size()), count);
+}
+
 BOOST_AUTO_TEST_CASE(TestConceptCompatibility) {
     // Test that our concept works correctly
     static_assert(HasPriorityOnVertices<TestGraph>, "TestGraph should satisfy HasPriorityOnVertices");
@@ -87,6 +87,40 @@ BOOST_AUTO_TEST_CASE(InvalidGraphTests) {
 
         BOOST_TEST(!is_valid(graph));
     }
+
+    // Test loop among probabilistic vertices
+    {
+        Stochastic_DiscountedGraph graph;
+        auto v0 = add_vertex(graph, "v0", 0);
+        auto v1 = add_vertex(graph, "v1", -1);
+        auto v2 = add_vertex(graph, "v2", -1);
+
+        add_edge(graph, v0, v1, "edge_0_1", 1.0, 0.5, 0.0);
+        add_edge(graph, v1, v2, "edge_1_2", 0.0, 0.0, 1.0);
+        add_edge(graph, v2, v0, "edge_2_0", 0.0, 0.0, 0.5);
+        add_edge(graph, v2, v1, "edge_2_1", 0.0, 0.0, 0.5); // v1 -> v2 -> v1 never leaves chance
+
+        BOOST_TEST(!is_valid(graph));
+    }
+}
+
+BOOST_AUTO_TEST_CASE(PlayerCyclesAreValid) {
+    using namespace ggg::graphs;
+
+    // Only loops among probabilistic vertices are rejected, so any owner of v0 and v1 is valid
+    for (const int player : {0, 1}) {
+        Stochastic_DiscountedGraph graph;
+        auto v0 = add_vertex(graph, "v0", player);
+        auto v1 = add_vertex(graph, "v1", player);
+        auto v2 = add_vertex(graph, "v2", -1);
+
+        add_edge(graph, v0, v1, "edge_0_1", 1.0, 0.5, 0.0);
+        add_edge(graph, v1, v0, "edge_1_0", -1.0, 0.5, 0.0);
+        add_edge(graph, v1, v2, "edge_1_2", 2.0, 0.5, 0.0);
+        add_edge(graph, v2, v0, "edge_2_0", 0.0, 0.0, 1.0);
+
+        BOOST_TEST(is_valid(graph));
+    }
 }
 
 BOOST_AUTO_TEST_CASE(NonProbabilisticVerticesTest) {
@@ -0,0 +1,126 @@
+#include "libggg/ownership/design.hpp"
+#include <boost/test/unit_test.hpp>
+#include <bit>
+#include <set>
+#include <vector>
+
+using namespace ggg::ownership;
+namespace bitsliced = ggg::solvers::bitsliced;
+
+BOOST_AUTO_TEST_SUITE(SamplingDesignTests)
+
+BOOST_AUTO_TEST_CASE(TestPrimitivePolynomials) {
+    // Number of primitive polynomials of degree 1 .. 6 is phi(2^s - 1) / s
+    const int expected[] = {1, 1, 2, 2, 6, 6};
+    for (int degree = 1; degree <= 6; ++degree) {
+        int count = 0;
+        for (std::uint64_t p = (std::uint64_t(1) << degree) | 1; p < (std::uint64_t(1) << (degree + 1)); p += 2) {
+            count += detail::is_primitive(p, degree) ? 1 : 0;
+        }
+        BOOST_CHECK_EQUAL(count, expected[degree - 1]);
+    }
+    // The first two Sobol dimensions are van der Corput and the parity of the index
+    const auto rows = detail::sobol_first_digit_rows(3, 6);
+    BOOST_CHECK_EQUAL(rows[0], 1u);
+    BOOST_CHECK_EQUAL(rows[1], 63u);
+}
+
+BOOST_AUTO_TEST_CASE(TestAntitheticAndBalanced) {
+    const int n = 10;
+    std::vector<char> pinned(n, 0);
+    pinned[3] = 1;
+    bitsliced::SlicedSet player1;
+
+    OwnershipDesign antithetic(Design::Antithetic, n, 1);
+    antithetic.draw(player1, ~bitsliced::Lanes(0), pinned);
+    for (int v = 0; v < n; ++v) {
+        if (v == 3) {
+            BOOST_CHECK_EQUAL(player1[v], 0u);
+            continue;
+        }
+        // Lane 2k + 1 is the complement of lane 2k
+        BOOST_CHECK_EQUAL((player1[v] ^ (player1[v] >> 1)) & 0x5555555555555555ull, 0x5555555555555555ull);
+    }
+
+    OwnershipDesign balanced(Design::Balanced, n, 2);
+    balanced.draw(player1, ~bitsliced::Lanes(0), pinned);
+    for (int v = 0; v < n; ++v) {
+        BOOST_CHECK_EQUAL(std::popcount(player1[v]), v == 3 ? 0 : 32);
+    }
+    balanced.draw(player1, bitsliced::first_lanes(10), pinned);
+    for (int v = 0; v < n; ++v) {
+        BOOST_CHECK_EQUAL(player1[v] & ~bitsliced::first_lanes(10), 0u);
+        BOOST_CHECK_EQUAL(std::popcount(player1[v]), v == 3 ? 0 : 5);
+    }
+}
+
+BOOST_AUTO_TEST_CASE(TestSobolBlocksAreBalancedAndPairwiseIndependent) {
+    // 40 vertices need 7 index bits, so one block spans two batches
+    const int n = 40;
+    OwnershipDesign sobol(Design::Sobol, n, 3);
+    BOOST_REQUIRE_EQUAL(sobol.block_size(), 128);
+
+    std::vector<std::vector<int>> bits(n);
+    bitsliced::SlicedSet player1;
+    for (int batch = 0; batch < 2; ++batch) {
+        sobol.draw(player1, ~bitsliced::Lanes(0), {});
+        for (int v = 0; v < n; ++v) {
+            for (int lane = 0; lane < 64; ++lane) {
+                bits[v].push_back(static_cast<int>((player1[v] >> lane) & 1));
+            }
+        }
+    }
+
+    const auto rows = detail::sobol_first_digit_rows(n, 7);
+    for (int v = 0; v < n; ++v) {
+        int ones = 0;
+        for (const int bit : bits[v]) {
+            ones += bit;
+        }
+        BOOST_CHECK_EQUAL(ones, 64);
+        for (int w = v + 1; w < n; ++w) {
+            if (rows[v] == rows[w]) {
+                continue;
+            }
+            int both = 0;
+            for (int i = 0; i < 128; ++i) {
+                both += bits[v][i] & bits[w][i];
+            }
+            BOOST_CHECK_EQUAL(both, 32);
+        }
+    }
+}
+
+BOOST_AUTO_TEST_CASE(TestBlockEstimator) {
+    // Blocks of one sample give the Bernoulli variance p (1 - p) / (N - 1)
+    BlockEstimator iid(1);
+    iid.add(0b1011, 4);
+    iid.finish();
+    BOOST_CHECK_EQUAL(iid.wins(), 3);
+    BOOST_CHECK_CLOSE(iid.estimate(), 0.75, 1e-9);
+    BOOST_CHECK_CLOSE(iid.variance(), 0.75 * 0.25 / 3.0, 1e-9);
+
+    // Blocks with equal means have no between-block variance
+    BlockEstimator pairs(2);
+    pairs.add(0b011001, 6);
+    pairs.finish();
+    BOOST_CHECK_EQUAL(pairs.blocks(), 3);
+    BOOST_CHECK_CLOSE(pairs.estimate(), 0.5, 1e-9);
+    BOOST_CHECK_SMALL(pairs.variance(), 1e-12);
+
+    // Merging matches one estimator fed everything
+    BlockEstimator first(2);
+    BlockEstimator second(2);
+    BlockEstimator all(2);
+    first.add(0b0111, 4);
+    second.add(0b0010, 4);
+    all.add(0b00100111, 8);
+    first.finish();
+    second.finish();
+    all.finish();
+    first.merge(second);
+    BOOST_CHECK_EQUAL(first.blocks(), all.blocks());
+    BOOST_CHECK_CLOSE(first.variance(), all.variance(), 1e-9);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
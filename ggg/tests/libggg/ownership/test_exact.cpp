@@ -0,0 +1,253 @@
+#include "libggg/graphs/parity_graph.hpp"
+#include "libggg/ownership/exact.hpp"
+#include "libggg/ownership/tree_decomposition.hpp"
+#include "libggg/solvers/bitboard.hpp"
+#include <boost/test/unit_test.hpp>
+#include <random>
+
+using namespace ggg::graphs;
+using namespace ggg::ownership;
+namespace bitboard = ggg::solvers::bitboard;
+namespace bitsliced = ggg::solvers::bitsliced;
+
+namespace {
+
+/**
+ * @brief Sparse random game with priorities 0/1, self-loops and occasional dead ends
+ */
+ParityGraph make_sparse_graph(int num_vertices, std::mt19937 &rng) {
+    ParityGraph graph;
+    std::uniform_int_distribution<int> degree_dist(0, 2);
+    std::uniform_int_distribution<int> offset_dist(-2, 2);
+    for (int i = 0; i < num_vertices; ++i) {
+        add_vertex(graph, "v" + std::to_string(i), 0, (rng() % 5) == 0 ? 1 : 0);
+    }
+    for (int i = 0; i < num_vertices; ++i) {
+        const int degree = degree_dist(rng);
+        for (int j = 0; j < degree; ++j) {
+            const int target = std::clamp(i + offset_dist(rng), 0, num_vertices - 1);
+            add_edge(graph, i, target, "");
+        }
+    }
+    return graph;
+}
+
+/**
+ * @brief Min-fill order recomputed from a dense adjacency matrix at every step
+ */
+std::vector<int> dense_min_fill_order(const bitsliced::Arena &arena) {
+    const int n = arena.num_vertices;
+    std::vector<std::vector<char>> adjacent(n, std::vector<char>(n, 0));
+    for (int v = 0; v < n; ++v) {
+        for (int s = arena.successor_offsets[v]; s < arena.successor_offsets[v + 1]; ++s) {
+            const int w = arena.successors[s];
+            adjacent[v][w] = adjacent[w][v] = w != v;
+        }
+    }
+    std::vector<char> eliminated(n, 0);
+    std::vector<int> order;
+    for (int step = 0; step < n; ++step) {
+        int best = -1;
+        std::pair<long, int> best_key;
+        for (int v = 0; v < n; ++v) {
+            std::vector<int> neighbours;
+            for (int w = 0; w < n; ++w) {
+                if (!eliminated[v] && !eliminated[w] && adjacent[v][w]) {
+                    neighbours.push_back(w);
+                }
+            }
+            long fill = 0;
+            for (size_t i = 0; i < neighbours.size(); ++i) {
+                for (size_t j = i + 1; j < neighbours.size(); ++j) {
+                    fill += adjacent[neighbours[i]][neighbours[j]] ? 0 : 1;
+                }
+            }
+            const std::pair<long, int> key{fill, static_cast<int>(neighbours.size())};
+            if (!eliminated[v] && (best == -1 || key < best_key)) {
+                best = v;
+                best_key = key;
+            }
+        }
+        for (int a = 0; a < n; ++a) {
+            for (int b = 0; b < n; ++b) {
+                if (a != b && !eliminated[a] && !eliminated[b] && adjacent[best][a] && adjacent[best][b]) {
+                    adjacent[a][b] = 1;
+                }
+            }
+        }
+        eliminated[best] = 1;
+        order.push_back(best);
+    }
+    return order;
+}
+
+/**
+ * @brief Winning assignments counted one assignment at a time with the bitboard solver
+ */
+std::uint64_t count_by_bitboard(const ParityGraph &graph, Objective objective, int query) {
+    const auto arena = bitboard::make_arena<bitboard::Mask64>(graph);
+    const int n = arena.num_vertices;
+    std::uint64_t wins = 0;
+    for (std::uint64_t owners = 0; owners < (std::uint64_t(1) << n); ++owners) {
+        bitboard::Mask64 won0;
+        if (objective == Objective::Reachability) {
+            won0 = bitboard::solve_reachability(arena, owners);
+        } else {
+            won0 = bitboard::solve_parity(arena, owners);
+        }
+        wins += (won0 >> query) & 1;
+    }
+    return wins;
+}
+
+} // namespace
+
+BOOST_AUTO_TEST_SUITE(ExactProbabilityTests)
+
+BOOST_AUTO_TEST_CASE(TestMinFillOnPathAndCycle) {
+    ParityGraph path;
+    for (int i = 0; i < 6; ++i) {
+        add_vertex(path, "v" + std::to_string(i), 0, 0);
+    }
+    for (int i = 0; i + 1 < 6; ++i) {
+        add_edge(path, i, i + 1, "");
+    }
+    BOOST_CHECK_EQUAL(min_fill_order(bitsliced::make_arena(path)).width, 1);
+
+    add_edge(path, 5, 0, "");
+    const auto order = min_fill_order(bitsliced::make_arena(path));
+    BOOST_CHECK_EQUAL(order.width, 2);
+    BOOST_CHECK_EQUAL(order.order.size(), 6u);
+}
+
+BOOST_AUTO_TEST_CASE(TestMinFillMatchesDenseRecount) {
+    std::mt19937 rng(11);
+    for (int round = 0; round < 40; ++round) {
+        const int n = 5 + round % 20;
+        ParityGraph graph;
+        for (int i = 0; i < n; ++i) {
+            add_vertex(graph, "v" + std::to_string(i), 0, 0);
+        }
+        for (int e = 0; e < n + round; ++e) {
+            add_edge(graph, static_cast<int>(rng() % n), static_cast<int>(rng() % n), "");
+        }
+        const auto arena = bitsliced::make_arena(graph);
+        BOOST_CHECK(min_fill_order(arena).order == dense_min_fill_order(arena));
+    }
+}
+
+BOOST_AUTO_TEST_CASE(TestMinFillStopsOverMaxWidth) {
+    // A long sparse path with a hub: the hub is eliminated last, when it has no neighbours left
+    const int n = 20000;
+    ParityGraph star;
+    for (int i = 0; i < n; ++i) {
+        add_vertex(star, "v" + std::to_string(i), 0, 0);
+    }
+    for (int i = 1; i < n; ++i) {
+        add_edge(star, 0, i, "");
+        if (i + 1 < n) {
+            add_edge(star, i, i + 1, "");
+        }
+    }
+    const auto order = min_fill_order(bitsliced::make_arena(star), 10);
+    BOOST_CHECK_EQUAL(order.order.size(), std::size_t(n));
+    BOOST_CHECK_EQUAL(order.width, 2);
+
+    // A 40x40 grid has width 40 and stops at the first bag over the limit
+    ParityGraph grid;
+    for (int i = 0; i < 1600; ++i) {
+        add_vertex(grid, "v" + std::to_string(i), 0, i == 1599 ? 1 : 0);
+    }
+    for (int i = 0; i < 1600; ++i) {
+        if (i % 40 != 39) {
+            add_edge(grid, i, i + 1, "");
+        }
+        if (i + 40 < 1600) {
+            add_edge(grid, i, i + 40, "");
+        }
+    }
+    const auto arena = bitsliced::make_arena(grid);
+    const auto partial = min_fill_order(arena, 6);
+    BOOST_CHECK_LT(partial.order.size(), std::size_t(1600));
+    BOOST_CHECK_EQUAL(partial.width, 7);
+    BOOST_CHECK(!reachability_by_elimination(arena, 0, partial, 20).has_value());
+}
+
+BOOST_AUTO_TEST_CASE(TestEnumerationMatchesBitboard) {
+    std::mt19937 rng(3);
+    for (int round = 0; round < 6; ++round) {
+        const int n = 4 + round * 2;
+        const auto graph = make_sparse_graph(n, rng);
+        const auto arena = bitsliced::make_arena(graph);
+        for (const auto objective : {Objective::Reachability, Objective::Parity}) {
+            const auto result = enumerate(arena, objective, 0);
+            BOOST_CHECK_EQUAL(result.total, Count(1) << n);
+            BOOST_CHECK_EQUAL(result.wins, Count(count_by_bitboard(graph, objective, 0)));
+        }
+    }
+}
+
+BOOST_AUTO_TEST_CASE(TestEliminationMatchesEnumeration) {
+    std::mt19937 rng(17);
+    for (int round = 0; round < 30; ++round) {
+        const int n = 3 + round % 12;
+        const auto graph = make_sparse_graph(n, rng);
+        const auto arena = bitsliced::make_arena(graph);
+        const auto order = min_fill_order(arena);
+        const int query = static_cast<int>(rng() % n);
+
+        const auto exact = reachability_by_elimination(arena, query, order);
+        BOOST_REQUIRE(exact.has_value());
+        BOOST_CHECK_EQUAL(exact->width, order.width);
+        BOOST_CHECK_EQUAL(exact->total, Count(1) << n);
+        BOOST_CHECK_EQUAL(exact->wins, enumerate(arena, Objective::Reachability, query).wins);
+    }
+}
+
+BOOST_AUTO_TEST_CASE(TestEliminationBeyondEnumeration) {
+    // A long ladder has width 2, far too many vertices to enumerate
+    ParityGraph graph;
+    const int rungs = 60;
+    for (int i = 0; i < 2 * rungs; ++i) {
+        add_vertex(graph, "v" + std::to_string(i), 0, i == 2 * rungs - 1 ? 1 : 0);
+    }
+    for (int i = 0; i < rungs; ++i) {
+        add_edge(graph, 2 * i, 2 * i + 1, "");
+        add_edge(graph, 2 * i + 1, 2 * i, "");
+        if (i + 1 < rungs) {
+            add_edge(graph, 2 * i, 2 * i + 2, "");
+            add_edge(graph, 2 * i + 1, 2 * i + 3, "");
+        }
+    }
+    const auto arena = bitsliced::make_arena(graph);
+    const auto order = min_fill_order(arena);
+    BOOST_CHECK_LE(order.width, 3);
+
+    const auto exact = reachability_by_elimination(arena, 0, order);
+    BOOST_REQUIRE(exact.has_value());
+    BOOST_CHECK_EQUAL(exact->total, Count(1) << (2 * rungs));
+    BOOST_CHECK(exact->wins > 0);
+    BOOST_CHECK(exact->wins < exact->total);
+
+    // Small tables, but merging them is bounded by the work budget as well
+    BOOST_CHECK(reachability_by_elimination(arena, 0, order, 10, std::size_t(1) << 16, 1000).has_value());
+    BOOST_CHECK(!reachability_by_elimination(arena, 0, order, 10, std::size_t(1) << 16, 16).has_value());
+}
+
+BOOST_AUTO_TEST_CASE(TestEliminationGivesUpOnWideArenas) {
+    ParityGraph clique;
+    for (int i = 0; i < 8; ++i) {
+        add_vertex(clique, "v" + std::to_string(i), 0, i == 7 ? 1 : 0);
+    }
+    for (int i = 0; i < 8; ++i) {
+        for (int j = 0; j < 8; ++j) {
+            add_edge(clique, i, j, "");
+        }
+    }
+    const auto arena = bitsliced::make_arena(clique);
+    const auto order = min_fill_order(arena);
+    BOOST_CHECK_EQUAL(order.width, 7);
+    BOOST_CHECK(!reachability_by_elimination(arena, 0, order, 4).has_value());
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,87 @@
+#include "libggg/graphs/parity_graph.hpp"
+#include "libggg/ownership/exact.hpp"
+#include "libggg/ownership/irrelevant.hpp"
+#include "libggg/ownership/symmetry.hpp"
+#include <boost/test/unit_test.hpp>
+#include <random>
+
+using namespace ggg::graphs;
+using namespace ggg::ownership;
+namespace bitsliced = ggg::solvers::bitsliced;
+
+BOOST_AUTO_TEST_SUITE(IrrelevantVertexTests)
+
+BOOST_AUTO_TEST_CASE(TestSingleSuccessorAndCore) {
+    // v0 -> {v1, v3}, v1 -> v3 (target, self-loop), v2 -> {v3, v4}, v4 -> {v3, v4}
+    ParityGraph graph;
+    add_vertex(graph, "v0", 0, 0);
+    add_vertex(graph, "v1", 0, 0);
+    add_vertex(graph, "v2", 0, 0);
+    add_vertex(graph, "v3", 0, 1);
+    add_vertex(graph, "v4", 0, 0);
+    add_edge(graph, 0, 1, "");
+    add_edge(graph, 0, 3, "");
+    add_edge(graph, 1, 3, "");
+    add_edge(graph, 2, 3, "");
+    add_edge(graph, 2, 4, "");
+    add_edge(graph, 3, 3, "");
+    add_edge(graph, 4, 3, "");
+    add_edge(graph, 4, 4, "");
+
+    const auto arena = bitsliced::make_arena(graph);
+    const auto result = irrelevant_vertices(arena, Objective::Reachability);
+    // v1 and v3 have one successor; v0's successors are both always won; v2 and v4 are not
+    BOOST_CHECK_EQUAL(result.count, 3);
+    BOOST_CHECK(result.irrelevant[0]);
+    BOOST_CHECK(result.irrelevant[1]);
+    BOOST_CHECK(!result.irrelevant[2]);
+    BOOST_CHECK(result.irrelevant[3]);
+    BOOST_CHECK(!result.irrelevant[4]);
+}
+
+BOOST_AUTO_TEST_CASE(TestDeadEndsDisableCoreForParity) {
+    ParityGraph graph;
+    add_vertex(graph, "v0", 0, 0);
+    add_vertex(graph, "v1", 0, 0);
+    add_vertex(graph, "v2", 0, 0);
+    add_edge(graph, 0, 1, "");
+    add_edge(graph, 0, 2, "");
+    add_edge(graph, 1, 1, "");
+
+    const auto result = irrelevant_vertices(bitsliced::make_arena(graph), Objective::Parity);
+    BOOST_CHECK_EQUAL(result.count, 1);
+    BOOST_CHECK(result.irrelevant[1]);
+}
+
+BOOST_AUTO_TEST_CASE(TestPinnedEnumerationMatchesEnumeration) {
+    std::mt19937 rng(5);
+    for (int round = 0; round < 20; ++round) {
+        const int n = 6 + round % 8;
+        ParityGraph graph;
+        for (int i = 0; i < n; ++i) {
+            add_vertex(graph, "v" + std::to_string(i), 0, static_cast<int>(rng() % 2));
+        }
+        for (int i = 0; i < n; ++i) {
+            const int degree = 1 + static_cast<int>(rng() % 3);
+            for (int j = 0; j < degree; ++j) {
+                add_edge(graph, i, static_cast<int>(rng() % n), "");
+            }
+        }
+        const auto arena = bitsliced::make_arena(graph);
+
+        for (const auto objective : {Objective::Reachability, Objective::Buchi, Objective::Parity}) {
+            const auto irrelevant = irrelevant_vertices(arena, objective);
+            BOOST_CHECK(irrelevant.count > 0);
+            const auto plain = enumerate(arena, objective, 0);
+            const auto reduced = enumerate(arena, objective, 0, irrelevant.irrelevant);
+            BOOST_CHECK_EQUAL(reduced.wins, plain.wins);
+            BOOST_CHECK_EQUAL(reduced.total, plain.total);
+            BOOST_CHECK_EQUAL(reduced.solved, plain.solved >> irrelevant.count);
+
+            const auto group = automorphism_group(arena, 0);
+            BOOST_CHECK_EQUAL(enumerate_symmetric(arena, objective, 0, group, irrelevant.irrelevant).wins, plain.wins);
+        }
+    }
+}
+
+BOOST_AUTO_TEST_SUITE_END()
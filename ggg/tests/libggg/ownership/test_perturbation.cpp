@@ -0,0 +1,145 @@
+#include "libggg/graphs/parity_graph.hpp"
+#include "libggg/ownership/objective.hpp"
+#include "libggg/ownership/perturbation.hpp"
+#include "libggg/solvers/bitboard.hpp"
+#include "random_games.hpp"
+#include <boost/test/unit_test.hpp>
+#include <bit>
+#include <random>
+
+using namespace ggg::graphs;
+using namespace ggg::ownership;
+namespace bitboard = ggg::solvers::bitboard;
+namespace bitsliced = ggg::solvers::bitsliced;
+using ggg::testing::random_parity_game;
+
+namespace {
+
+/**
+ * @brief The arena of one lane of an overlay, rebuilt as a graph
+ */
+ParityGraph lane_graph(const bitsliced::Arena &arena, const bitsliced::Overlay &overlay, int lane) {
+    ParityGraph graph;
+    for (int v = 0; v < arena.num_vertices; ++v) {
+        int priority = arena.priority[v];
+        for (const auto &[p, members] : overlay.priority_classes) {
+            if ((members[v] >> lane) & 1) {
+                priority = p;
+            }
+        }
+        add_vertex(graph, "v" + std::to_string(v), 0, priority);
+    }
+    for (int v = 0; v < arena.num_vertices; ++v) {
+        for (int s = arena.successor_offsets[v]; s < arena.successor_offsets[v + 1]; ++s) {
+            if (overlay.present.empty() || ((overlay.present[s] >> lane) & 1)) {
+                add_edge(graph, v, arena.successors[s], "");
+            }
+        }
+    }
+    return graph;
+}
+
+} // namespace
+
+BOOST_AUTO_TEST_SUITE(PerturbationTests)
+
+BOOST_AUTO_TEST_CASE(TestBernoulliLanes) {
+    std::mt19937_64 rng(5);
+    BOOST_CHECK_EQUAL(bernoulli_lanes(1.0, rng), ~bitsliced::Lanes(0));
+    BOOST_CHECK_EQUAL(bernoulli_lanes(0.0, rng), 0u);
+    for (const double probability : {0.5, 0.3, 0.05}) {
+        long set = 0;
+        for (int i = 0; i < 2000; ++i) {
+            set += std::popcount(bernoulli_lanes(probability, rng));
+        }
+        BOOST_CHECK_CLOSE(set / (2000.0 * 64), probability, 5.0);
+    }
+}
+
+BOOST_AUTO_TEST_CASE(TestEdgesKeepASuccessor) {
+    std::mt19937_64 rng(9);
+    const auto graph = random_parity_game(40, 0, 3, rng, {1, 4, false});
+    const auto arena = bitsliced::make_arena(graph);
+    bitsliced::SlicedSet present;
+    long kept = 0;
+    for (int round = 0; round < 50; ++round) {
+        draw_edges(arena, 0.2, rng, present);
+        BOOST_REQUIRE_EQUAL(present.size(), arena.successors.size());
+        for (int v = 0; v < arena.num_vertices; ++v) {
+            bitsliced::Lanes any = 0;
+            for (int s = arena.successor_offsets[v]; s < arena.successor_offsets[v + 1]; ++s) {
+                any |= present[s];
+                kept += std::popcount(present[s]);
+            }
+            BOOST_CHECK_EQUAL(any, ~bitsliced::Lanes(0));
+        }
+    }
+    // Redrawn dead ends push the rate above 0.2, but far from keeping every edge
+    const double rate = kept / (50.0 * 64 * arena.successors.size());
+    BOOST_CHECK_GT(rate, 0.2);
+    BOOST_CHECK_LT(rate, 0.6);
+}
+
+BOOST_AUTO_TEST_CASE(TestJitterStaysInRange) {
+    std::mt19937_64 rng(13);
+    const auto graph = random_parity_game(30, 0, 4, rng, {1, 4, false});
+    const auto arena = bitsliced::make_arena(graph);
+    bitsliced::Overlay overlay;
+    jitter_priorities(arena, 2, rng, overlay);
+    for (int v = 0; v < arena.num_vertices; ++v) {
+        bitsliced::Lanes covered = 0;
+        for (const auto &[p, members] : overlay.priority_classes) {
+            BOOST_CHECK_EQUAL(covered & members[v], 0u);
+            covered |= members[v];
+            if (members[v]) {
+                BOOST_CHECK_GE(p, 0);
+                BOOST_CHECK_LE(std::abs(p - arena.priority[v]), 2);
+            }
+        }
+        BOOST_CHECK_EQUAL(covered, ~bitsliced::Lanes(0));
+    }
+}
+
+BOOST_AUTO_TEST_CASE(TestOverlayMatchesRebuiltArenas) {
+    std::mt19937_64 rng(21);
+    for (int round = 0; round < 12; ++round) {
+        const auto objective = static_cast<Objective>(round % 3);
+        const bool two_priorities = objective != Objective::Parity;
+        const auto graph = random_parity_game(36, 0, two_priorities ? 1 : 4, rng, {1, 4, false});
+        const auto arena = bitsliced::make_arena(graph);
+
+        bitsliced::Overlay overlay;
+        draw_edges(arena, 0.5, rng, overlay.present);
+        if (!two_priorities) {
+            jitter_priorities(arena, 1, rng, overlay);
+        }
+        bitsliced::SlicedSet player1(arena.num_vertices);
+        for (auto &word : player1) {
+            word = rng();
+        }
+        const auto core = ownership_independent_core(arena, objective);
+        const auto won = solve_lanes(arena, objective, player1, ~bitsliced::Lanes(0), core.empty() ? nullptr : &core, &overlay);
+
+        for (int lane = 0; lane < bitsliced::lane_count; lane += 7) {
+            const auto rebuilt = lane_graph(arena, overlay, lane);
+            const auto board = bitboard::make_arena<bitboard::Mask64>(rebuilt);
+            bitboard::Mask64 owners = 0;
+            for (int v = 0; v < arena.num_vertices; ++v) {
+                owners |= bitboard::Mask64((player1[v] >> lane) & 1) << v;
+            }
+            bitboard::Mask64 expected = 0;
+            if (objective == Objective::Reachability) {
+                expected = bitboard::solve_reachability(board, owners);
+            } else if (objective == Objective::Buchi) {
+                expected = bitboard::solve_buchi(board, owners);
+            } else {
+                expected = bitboard::solve_parity(board, owners);
+            }
+            for (int v = 0; v < arena.num_vertices; ++v) {
+                BOOST_CHECK_EQUAL((won[v] >> lane) & 1, (expected >> v) & 1);
+            }
+        }
+    }
+}
+
+BOOST_AUTO_TEST_SUITE_END()
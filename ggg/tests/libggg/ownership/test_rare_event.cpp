@@ -0,0 +1,96 @@
+#include "libggg/graphs/parity_graph.hpp"
+#include "libggg/ownership/rare_event.hpp"
+#include <boost/test/unit_test.hpp>
+#include <bit>
+#include <cmath>
+#include <random>
+#include <string>
+
+using namespace ggg::graphs;
+using namespace ggg::ownership;
+namespace bitsliced = ggg::solvers::bitsliced;
+
+namespace {
+/**
+ * @brief Chain v0 -> ... -> v(k-1) -> target where every chain vertex may also escape to a sink
+ *
+ * Player 0 reaches the target only if it owns every chain vertex: probability 2^-k.
+ */
+ParityGraph make_escape_chain(int k) {
+    ParityGraph graph;
+    for (int i = 0; i < k; ++i) {
+        add_vertex(graph, "v" + std::to_string(i), 0, 0);
+    }
+    const auto target = add_vertex(graph, "target", 0, 1);
+    const auto sink = add_vertex(graph, "sink", 0, 0);
+    for (int i = 0; i < k; ++i) {
+        add_edge(graph, i, i + 1 < k ? i + 1 : target, "");
+        add_edge(graph, i, sink, "");
+    }
+    add_edge(graph, target, target, "");
+    add_edge(graph, sink, sink, "");
+    return graph;
+}
+} // namespace
+
+BOOST_AUTO_TEST_SUITE(RareEventTests)
+
+BOOST_AUTO_TEST_CASE(TestBernoulliLanes) {
+    std::mt19937_64 rng(1);
+    long ones = 0;
+    for (int i = 0; i < 2000; ++i) {
+        ones += std::popcount(detail::bernoulli_lanes(48, rng));
+    }
+    // 48 / 256 of 128000 bits, within five standard deviations
+    BOOST_CHECK_SMALL(static_cast<double>(ones) - 128000.0 * 48 / 256, 5 * std::sqrt(128000.0 * 0.1875 * 0.8125));
+}
+
+BOOST_AUTO_TEST_CASE(TestTinyProbability) {
+    const int k = 20;
+    const auto arena = bitsliced::make_arena(make_escape_chain(k));
+    CrossEntropyOptions options;
+    options.level_samples = 2000;
+    options.final_samples = 20000;
+    const auto result = cross_entropy_estimate(arena, Objective::Reachability, 0, {}, options, 7);
+
+    // Plain Monte Carlo would need about 2^20 solves per win
+    const double exact = std::ldexp(1.0, -k);
+    BOOST_CHECK(result.reached);
+    BOOST_CHECK_LT(result.solves, 200000);
+    BOOST_CHECK_GT(result.hits, 1000);
+    BOOST_CHECK_LT(result.relative_error, 0.05);
+    BOOST_CHECK_CLOSE(result.standard_error, result.estimate * result.relative_error, 1e-9);
+    BOOST_CHECK_CLOSE(result.estimate, exact, 20.0);
+    // The tuned biases favour player 0 on the chain
+    BOOST_CHECK_LT(result.bias[0], 0.25);
+}
+
+BOOST_AUTO_TEST_CASE(TestCommonEventStaysUnbiased) {
+    const auto arena = bitsliced::make_arena(make_escape_chain(2));
+    CrossEntropyOptions options;
+    options.level_samples = 1000;
+    options.final_samples = 20000;
+    const auto result = cross_entropy_estimate(arena, Objective::Reachability, 0, {}, options, 3);
+    BOOST_CHECK(result.reached);
+    BOOST_CHECK_EQUAL(result.levels, 1);
+    BOOST_CHECK_CLOSE(result.estimate, 0.25, 5.0);
+}
+
+BOOST_AUTO_TEST_CASE(TestNoHits) {
+    // The target is unreachable: no sample is won, and the error is 0, not 0 * infinity
+    ParityGraph graph = make_escape_chain(3);
+    boost::remove_edge(2, 3, graph);
+    const auto arena = bitsliced::make_arena(graph);
+    CrossEntropyOptions options;
+    options.level_samples = 200;
+    options.final_samples = 1000;
+    options.max_levels = 3;
+    const auto result = cross_entropy_estimate(arena, Objective::Reachability, 0, {}, options, 5);
+    BOOST_CHECK(!result.reached);
+    BOOST_CHECK_EQUAL(result.hits, 0);
+    BOOST_CHECK_EQUAL(result.estimate, 0.0);
+    BOOST_CHECK_EQUAL(result.standard_error, 0.0);
+    BOOST_CHECK(std::isinf(result.relative_error));
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,112 @@
+#include "libggg/graphs/parity_graph.hpp"
+#include "libggg/ownership/exact.hpp"
+#include "libggg/ownership/symmetry.hpp"
+#include <boost/test/unit_test.hpp>
+#include <random>
+
+using namespace ggg::graphs;
+using namespace ggg::ownership;
+namespace bitsliced = ggg::solvers::bitsliced;
+
+namespace {
+
+/**
+ * @brief v0 with several identical random gadgets hanging off it
+ */
+ParityGraph make_gadget_graph(int copies, int gadget_size, std::mt19937 &rng) {
+    ParityGraph graph;
+    add_vertex(graph, "v0", 0, 0);
+    std::vector<int> priorities(gadget_size);
+    for (auto &priority : priorities) {
+        priority = static_cast<int>(rng() % 3);
+    }
+    std::vector<std::pair<int, int>> edges;
+    for (int i = 0; i < gadget_size; ++i) {
+        edges.emplace_back(i, static_cast<int>(rng() % gadget_size));
+        edges.emplace_back(i, -1); // back to v0
+        if (rng() % 2) {
+            edges.emplace_back(i, static_cast<int>(rng() % gadget_size));
+        }
+    }
+    for (int copy = 0; copy < copies; ++copy) {
+        const int offset = 1 + copy * gadget_size;
+        for (int i = 0; i < gadget_size; ++i) {
+            add_vertex(graph, "v" + std::to_string(offset + i), 0, priorities[i]);
+        }
+        add_edge(graph, 0, offset, "");
+        for (const auto &[s, t] : edges) {
+            add_edge(graph, offset + s, t < 0 ? 0 : offset + t, "");
+        }
+    }
+    return graph;
+}
+
+} // namespace
+
+BOOST_AUTO_TEST_SUITE(SymmetryTests)
+
+BOOST_AUTO_TEST_CASE(TestStarHasSymmetricGroup) {
+    ParityGraph star;
+    add_vertex(star, "v0", 0, 0);
+    for (int i = 1; i <= 5; ++i) {
+        add_vertex(star, "v" + std::to_string(i), 0, 1);
+        add_edge(star, 0, i, "");
+        add_edge(star, i, 0, "");
+    }
+    const auto group = automorphism_group(bitsliced::make_arena(star), 0);
+    BOOST_CHECK_EQUAL(group.order, Count(120));
+    BOOST_CHECK_EQUAL(group.moved.size(), 5u);
+}
+
+BOOST_AUTO_TEST_CASE(TestCycleFixingVertexHasTrivialGroup) {
+    ParityGraph cycle;
+    for (int i = 0; i < 6; ++i) {
+        add_vertex(cycle, "v" + std::to_string(i), 0, 0);
+    }
+    for (int i = 0; i < 6; ++i) {
+        add_edge(cycle, i, (i + 1) % 6, "");
+    }
+    const auto arena = bitsliced::make_arena(cycle);
+    BOOST_CHECK_EQUAL(automorphism_group(arena, 0).order, Count(1));
+    BOOST_CHECK(automorphism_group(arena, 0).generators.empty());
+
+    // Undirected cycle: only the reflection through v0 remains
+    for (int i = 0; i < 6; ++i) {
+        add_edge(cycle, (i + 1) % 6, i, "");
+    }
+    const auto group = automorphism_group(bitsliced::make_arena(cycle), 0);
+    BOOST_CHECK_EQUAL(group.order, Count(2));
+    BOOST_CHECK_EQUAL(group.moved.size(), 4u);
+}
+
+BOOST_AUTO_TEST_CASE(TestPrioritiesBreakSymmetry) {
+    ParityGraph star;
+    add_vertex(star, "v0", 0, 0);
+    for (int i = 1; i <= 4; ++i) {
+        add_vertex(star, "v" + std::to_string(i), 0, i <= 2 ? 1 : 2);
+        add_edge(star, 0, i, "");
+    }
+    BOOST_CHECK_EQUAL(automorphism_group(bitsliced::make_arena(star), 0).order, Count(4));
+}
+
+BOOST_AUTO_TEST_CASE(TestSymmetricEnumerationMatchesEnumeration) {
+    std::mt19937 rng(11);
+    for (int round = 0; round < 12; ++round) {
+        const int copies = 2 + round % 3;
+        const int gadget_size = 2 + round % 3;
+        const auto graph = make_gadget_graph(copies, gadget_size, rng);
+        const auto arena = bitsliced::make_arena(graph);
+        const auto group = automorphism_group(arena, 0);
+        BOOST_CHECK(group.order >= Count(copies));
+
+        for (const auto objective : {Objective::Reachability, Objective::Buchi, Objective::Parity}) {
+            const auto plain = enumerate(arena, objective, 0);
+            const auto reduced = enumerate_symmetric(arena, objective, 0, group);
+            BOOST_CHECK_EQUAL(reduced.total, plain.total);
+            BOOST_CHECK_EQUAL(reduced.wins, plain.wins);
+            BOOST_CHECK(reduced.solved < plain.solved);
+        }
+    }
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,285 @@
+#include "libggg/graphs/parity_graph.hpp"
+#include "libggg/graphs/player_utilities.hpp"
+#include "libggg/solvers/bitboard.hpp"
+#include "random_games.hpp"
+#include <array>
+#include <boost/test/unit_test.hpp>
+#include <random>
+#include <set>
+#include <vector>
+
+using namespace ggg::graphs;
+using namespace ggg::solvers::bitboard;
+using ggg::testing::random_parity_game;
+
+namespace {
+
+/**
+ * @brief Reference attractor on vertex flags, restricted to a region
+ */
+std::vector<bool> reference_attractor(const ParityGraph &graph, const std::vector<bool> &region,
+                                      const std::vector<bool> &target, int player) {
+    const auto n = boost::num_vertices(graph);
+    std::vector<bool> attracted(n, false);
+    for (size_t v = 0; v < n; ++v) {
+        attracted[v] = region[v] && target[v];
+    }
+
+    bool changed = true;
+    while (changed) {
+        changed = false;
+        for (size_t v = 0; v < n; ++v) {
+            if (!region[v] || attracted[v]) {
+                continue;
+            }
+            int into_attractor = 0;
+            int inside_region = 0;
+            const auto [out_begin, out_end] = boost::out_edges(v, graph);
+            for (auto it = out_begin; it != out_end; ++it) {
+                const auto w = boost::target(*it, graph);
+                if (region[w]) {
+                    ++inside_region;
+                    into_attractor += attracted[w] ? 1 : 0;
+                }
+            }
+            const bool owned = graph[v].player == player;
+            if ((owned && into_attractor > 0) || (!owned && inside_region > 0 && into_attractor == inside_region)) {
+                attracted[v] = true;
+                changed = true;
+            }
+        }
+    }
+    return attracted;
+}
+
+/**
+ * @brief Reference Zielonka returning player 0 winning flags
+ */
+std::vector<bool> reference_zielonka(const ParityGraph &graph, const std::vector<bool> &region) {
+    const auto n = boost::num_vertices(graph);
+    int max_priority = -1;
+    for (size_t v = 0; v < n; ++v) {
+        if (region[v]) {
+            max_priority = std::max(max_priority, graph[v].priority);
+        }
+    }
+    if (max_priority < 0) {
+        return std::vector<bool>(n, false);
+    }
+
+    const int player = max_priority % 2;
+    std::vector<bool> top(n, false);
+    for (size_t v = 0; v < n; ++v) {
+        top[v] = region[v] && graph[v].priority == max_priority;
+    }
+    const auto attracted = reference_attractor(graph, region, top, player);
+    std::vector<bool> sub_region(n, false);
+    for (size_t v = 0; v < n; ++v) {
+        sub_region[v] = region[v] && !attracted[v];
+    }
+    const auto sub_won0 = reference_zielonka(graph, sub_region);
+
+    std::vector<bool> opponent_won(n, false);
+    bool opponent_wins_something = false;
+    for (size_t v = 0; v < n; ++v) {
+        opponent_won[v] = sub_region[v] && (sub_won0[v] == (player == 1));
+        opponent_wins_something = opponent_wins_something || opponent_won[v];
+    }
+    if (!opponent_wins_something) {
+        std::vector<bool> won0(n, false);
+        for (size_t v = 0; v < n; ++v) {
+            won0[v] = region[v] && player == 0;
+        }
+        return won0;
+    }
+
+    const auto opponent_attracted = reference_attractor(graph, region, opponent_won, 1 - player);
+    std::vector<bool> rest(n, false);
+    for (size_t v = 0; v < n; ++v) {
+        rest[v] = region[v] && !opponent_attracted[v];
+    }
+    auto won0 = reference_zielonka(graph, rest);
+    for (size_t v = 0; v < n; ++v) {
+        if (opponent_attracted[v]) {
+            won0[v] = player == 1;
+        }
+    }
+    return won0;
+}
+
+template <typename Mask>
+std::vector<bool> to_flags(Mask mask, int num_vertices) {
+    std::vector<bool> flags(num_vertices, false);
+    for_each_vertex(mask, [&](int v) { flags[v] = true; });
+    return flags;
+}
+
+template <typename Mask>
+void check_parity_agrees(int num_vertices, int max_priority, unsigned seed) {
+    std::mt19937 rng(seed);
+    const auto graph = random_parity_game(num_vertices, 0, max_priority, rng);
+    const auto arena = make_arena<Mask>(graph);
+
+    std::vector<int> strategy(num_vertices, -1);
+    const Mask won0 = solve_parity(arena, arena.player1, strategy.data());
+    const std::vector<bool> all(num_vertices, true);
+    BOOST_CHECK(to_flags(won0, num_vertices) == reference_zielonka(graph, all));
+
+    // Every move of a winning player 0 vertex stays inside the player 0 region
+    for (int v = 0; v < num_vertices; ++v) {
+        if ((won0 & bit<Mask>(v)) && !(arena.player1 & bit<Mask>(v))) {
+            BOOST_REQUIRE(strategy[v] >= 0);
+            BOOST_CHECK(arena.successors[v] & bit<Mask>(strategy[v]));
+            BOOST_CHECK(won0 & bit<Mask>(strategy[v]));
+        }
+    }
+}
+
+} // namespace
+
+BOOST_AUTO_TEST_SUITE(BitboardTests)
+
+BOOST_AUTO_TEST_CASE(TestBitHelpers) {
+    const Mask128 high = bit<Mask128>(100) | bit<Mask128>(3);
+    BOOST_CHECK_EQUAL(lowest_bit(high), 3);
+    BOOST_CHECK_EQUAL(lowest_bit(high & ~bit<Mask128>(3)), 100);
+    BOOST_CHECK_EQUAL(count(high), 2);
+    BOOST_CHECK_EQUAL(count(~Mask64(0)), 64);
+
+    std::vector<int> visited;
+    for_each_vertex(high, [&](int v) { visited.push_back(v); });
+    BOOST_CHECK((visited == std::vector<int>{3, 100}));
+}
+
+BOOST_AUTO_TEST_CASE(TestMaskSelection) {
+    int width = 0;
+    BOOST_CHECK(with_mask_for(64, [&](auto mask) { width = static_cast<int>(capacity<decltype(mask)>); }));
+    BOOST_CHECK_EQUAL(width, 64);
+    BOOST_CHECK(with_mask_for(65, [&](auto mask) { width = static_cast<int>(capacity<decltype(mask)>); }));
+    BOOST_CHECK_EQUAL(width, 128);
+    BOOST_CHECK(!with_mask_for(129, [&](auto) {}));
+}
+
+BOOST_AUTO_TEST_CASE(TestArenaConstruction) {
+    ParityGraph graph;
+    const auto v0 = add_vertex(graph, "v0", 0, 2);
+    const auto v1 = add_vertex(graph, "v1", 1, 1);
+    const auto v2 = add_vertex(graph, "v2", 1, 2);
+    add_edge(graph, v0, v1, "");
+    add_edge(graph, v1, v2, "");
+    add_edge(graph, v2, v0, "");
+    add_edge(graph, v2, v2, "");
+
+    const auto arena = make_arena<Mask64>(graph);
+    BOOST_CHECK_EQUAL(arena.num_vertices, 3);
+    BOOST_CHECK(arena.vertices == 0b111);
+    BOOST_CHECK(arena.player1 == 0b110);
+    BOOST_CHECK(arena.successors[2] == 0b101);
+    BOOST_CHECK(arena.predecessors[0] == 0b100);
+    BOOST_REQUIRE_EQUAL(arena.priority_classes.size(), 2);
+    BOOST_CHECK_EQUAL(arena.priority_classes.front().first, 2);
+    BOOST_CHECK(arena.with_priority(2) == 0b101);
+    BOOST_CHECK(arena.with_priority(7) == 0);
+
+    std::mt19937 rng(1);
+    BOOST_CHECK_THROW(make_arena<Mask64>(random_parity_game(65, 0, 1, rng)), std::invalid_argument);
+}
+
+BOOST_AUTO_TEST_CASE(TestAttractorMatchesGenericAttractor) {
+    for (unsigned seed = 0; seed < 20; ++seed) {
+        std::mt19937 rng(seed);
+        const auto graph = random_parity_game(40, 0, 1, rng);
+        const auto arena = make_arena<Mask64>(graph);
+        const Mask64 target = arena.with_priority(1);
+
+        for (int player = 0; player < 2; ++player) {
+            std::set<ParityVertex> target_set;
+            for_each_vertex(target, [&](int v) { target_set.insert(v); });
+            const auto [expected, generic_strategy] = player_utilities::compute_attractor(graph, target_set, player);
+
+            std::vector<int> strategy(40, -1);
+            const Mask64 attracted = attractor(arena, arena.player1, arena.vertices, target, player, strategy.data());
+            BOOST_CHECK_EQUAL(count(attracted), static_cast<int>(expected.size()));
+            for (const auto v : expected) {
+                BOOST_CHECK(attracted & bit<Mask64>(static_cast<int>(v)));
+            }
+            for_each_vertex(attracted & ~target, [&](int v) {
+                if (graph[v].player == player) {
+                    BOOST_CHECK(attracted & bit<Mask64>(strategy[v]));
+                }
+            });
+        }
+    }
+}
+
+BOOST_AUTO_TEST_CASE(TestDeadEndsAreNotAttracted) {
+    ParityGraph graph;
+    const auto v0 = add_vertex(graph, "v0", 1, 0);
+    const auto v1 = add_vertex(graph, "v1", 1, 1);
+    add_vertex(graph, "v2", 1, 0);
+    add_edge(graph, v0, v1, "");
+
+    const auto arena = make_arena<Mask64>(graph);
+    const Mask64 attracted = solve_reachability(arena, arena.player1);
+    BOOST_CHECK(attracted == 0b011);
+}
+
+BOOST_AUTO_TEST_CASE(TestReachabilityFromCore) {
+    for (unsigned seed = 0; seed < 20; ++seed) {
+        std::mt19937 rng(seed);
+        const auto graph = random_parity_game(60, 0, 1, rng);
+        const auto arena = make_arena<Mask64>(graph);
+        const Mask64 target = arena.with_priority(1);
+        const Mask64 core = attractor_core(arena, arena.vertices, target);
+        BOOST_CHECK((target & ~core) == 0);
+
+        for (int round = 0; round < 5; ++round) {
+            const Mask64 owners = (Mask64(rng()) << 32 | rng()) & arena.vertices;
+            BOOST_CHECK((core & ~attractor(arena, owners, arena.vertices, target, 1)) == 0);
+
+            std::array<int, 64> strategy;
+            strategy.fill(-1);
+            const Mask64 attracted = solve_reachability_from(arena, owners, core, strategy.data());
+            BOOST_CHECK(attracted == solve_reachability(arena, owners));
+            for_each_vertex(attracted & ~target & ~owners, [&](int v) {
+                BOOST_REQUIRE(strategy[v] >= 0);
+                BOOST_CHECK(attracted & bit<Mask64>(strategy[v]));
+            });
+        }
+    }
+}
+
+BOOST_AUTO_TEST_CASE(TestBuchiMatchesZielonkaOnTwoPriorities) {
+    for (unsigned seed = 0; seed < 20; ++seed) {
+        std::mt19937 rng(seed);
+        const auto graph = random_parity_game(50, 0, 1, rng);
+        const auto arena = make_arena<Mask64>(graph);
+        const std::vector<bool> all(50, true);
+        BOOST_CHECK(to_flags(solve_buchi(arena, arena.player1), 50) == reference_zielonka(graph, all));
+    }
+}
+
+BOOST_AUTO_TEST_CASE(TestParity64) {
+    for (unsigned seed = 0; seed < 20; ++seed) {
+        check_parity_agrees<Mask64>(60, 5, seed);
+    }
+}
+
+BOOST_AUTO_TEST_CASE(TestParity128) {
+    for (unsigned seed = 0; seed < 10; ++seed) {
+        check_parity_agrees<Mask128>(120, 7, seed);
+    }
+}
+
+BOOST_AUTO_TEST_CASE(TestOwnershipOverride) {
+    std::mt19937 rng(7);
+    const auto graph = random_parity_game(30, 0, 1, rng);
+    const auto arena = make_arena<Mask64>(graph);
+
+    // Giving every vertex to player 0 can only grow player 0's reachability region
+    const Mask64 as_given = solve_reachability(arena, arena.player1);
+    const Mask64 all_player0 = solve_reachability(arena, Mask64(0));
+    BOOST_CHECK((as_given & ~all_player0) == 0);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
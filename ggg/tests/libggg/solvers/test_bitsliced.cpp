@@ -0,0 +1,136 @@
+#include "libggg/graphs/parity_graph.hpp"
+#include "libggg/solvers/bitboard.hpp"
+#include "libggg/solvers/bitsliced.hpp"
+#include "random_games.hpp"
+#include <boost/test/unit_test.hpp>
+#include <random>
+#include <vector>
+
+using namespace ggg::graphs;
+namespace bitboard = ggg::solvers::bitboard;
+namespace bitsliced = ggg::solvers::bitsliced;
+using ggg::testing::random_parity_game;
+
+namespace {
+
+/**
+ * @brief Vertex mask of a single lane of a sliced set
+ */
+bitboard::Mask64 lane_mask(const bitsliced::SlicedSet &set, int lane) {
+    bitboard::Mask64 mask = 0;
+    for (size_t v = 0; v < set.size(); ++v) {
+        if ((set[v] >> lane) & 1) {
+            mask |= bitboard::bit<bitboard::Mask64>(static_cast<int>(v));
+        }
+    }
+    return mask;
+}
+
+} // namespace
+
+BOOST_AUTO_TEST_SUITE(BitslicedTests)
+
+BOOST_AUTO_TEST_CASE(TestArenaConstruction) {
+    ParityGraph graph;
+    add_vertex(graph, "v0", 0, 3);
+    add_vertex(graph, "v1", 1, 0);
+    add_vertex(graph, "v2", 1, 3);
+    add_edge(graph, 0, 1, "");
+    add_edge(graph, 0, 2, "");
+    add_edge(graph, 2, 0, "");
+
+    const auto arena = bitsliced::make_arena(graph);
+    BOOST_CHECK_EQUAL(arena.num_vertices, 3);
+    BOOST_CHECK((std::vector<int>(arena.successors.begin() + arena.successor_offsets[0],
+                                  arena.successors.begin() + arena.successor_offsets[1]) == std::vector<int>{1, 2}));
+    BOOST_CHECK_EQUAL(arena.predecessor_offsets[2] - arena.predecessor_offsets[1], 1);
+    BOOST_CHECK_EQUAL(arena.predecessor_offsets[3] - arena.predecessor_offsets[2], 1);
+    BOOST_REQUIRE_EQUAL(arena.priority_classes.size(), 2);
+    BOOST_CHECK((arena.priority_classes.front().second == std::vector<int>{0, 2}));
+    BOOST_CHECK_EQUAL(bitsliced::first_lanes(3), 0b111u);
+    BOOST_CHECK_EQUAL(bitsliced::first_lanes(64), ~bitsliced::Lanes(0));
+}
+
+BOOST_AUTO_TEST_CASE(TestLanesMatchBitboard) {
+    std::mt19937_64 rng(42);
+    for (int round = 0; round < 10; ++round) {
+        const int n = 20 + round * 4;
+        const auto graph = random_parity_game(n, 0, 1 + round % 6, rng, {1, 3, false});
+        const auto sliced_arena = bitsliced::make_arena(graph);
+        const auto board_arena = bitboard::make_arena<bitboard::Mask64>(graph);
+
+        bitsliced::SlicedSet player1(n);
+        for (auto &word : player1) {
+            word = rng();
+        }
+        const auto lanes = bitsliced::first_lanes(round == 0 ? 37 : 64);
+
+        const auto parity = bitsliced::solve_parity(sliced_arena, player1, lanes);
+        const auto reach = bitsliced::solve_reachability(sliced_arena, player1, lanes);
+        const auto core = bitsliced::reachability_core(sliced_arena);
+        BOOST_CHECK(bitsliced::solve_reachability_from(sliced_arena, player1, lanes, core) == reach);
+        const bool two_priorities = sliced_arena.priority_classes.front().first <= 1;
+        const auto buchi = two_priorities ? bitsliced::solve_buchi(sliced_arena, player1, lanes) : bitsliced::SlicedSet(n, 0);
+
+        for (int lane = 0; lane < bitsliced::lane_count; ++lane) {
+            if (!((lanes >> lane) & 1)) {
+                BOOST_CHECK_EQUAL(lane_mask(parity, lane), 0u);
+                continue;
+            }
+            const auto owners = lane_mask(player1, lane);
+            BOOST_CHECK_EQUAL(lane_mask(parity, lane), bitboard::solve_parity(board_arena, owners));
+            BOOST_CHECK_EQUAL(lane_mask(reach, lane), bitboard::solve_reachability(board_arena, owners));
+            if (two_priorities) {
+                BOOST_CHECK_EQUAL(lane_mask(buchi, lane), bitboard::solve_buchi(board_arena, owners));
+            }
+        }
+    }
+}
+
+BOOST_AUTO_TEST_CASE(TestMultiTargetAttractors) {
+    std::mt19937_64 rng(11);
+    for (int round = 0; round < 10; ++round) {
+        const int n = 40 + round;
+        const auto graph = random_parity_game(n, 0, 3, rng, {1, 3, false});
+        const auto sliced_arena = bitsliced::make_arena(graph);
+        const auto board_arena = bitboard::make_arena<bitboard::Mask64>(graph);
+
+        std::vector<char> player1(n);
+        std::vector<char> region(n);
+        bitboard::Mask64 owners = 0;
+        bitboard::Mask64 region_mask = 0;
+        bitsliced::SlicedSet targets(n);
+        for (int v = 0; v < n; ++v) {
+            player1[v] = static_cast<char>(rng() & 1);
+            region[v] = (rng() % 8) != 0;
+            owners |= bitboard::Mask64(player1[v]) << v;
+            region_mask |= bitboard::Mask64(region[v]) << v;
+            targets[v] = rng() & rng();
+        }
+
+        for (int player = 0; player < 2; ++player) {
+            const auto attracted = bitsliced::attractors(sliced_arena, player1, region, targets, player);
+            for (int lane = 0; lane < bitsliced::lane_count; ++lane) {
+                const auto expected = bitboard::attractor(board_arena, owners, region_mask, lane_mask(targets, lane), player);
+                BOOST_CHECK_EQUAL(lane_mask(attracted, lane), expected);
+            }
+        }
+    }
+}
+
+BOOST_AUTO_TEST_CASE(TestLargerThanBitboard) {
+    std::mt19937_64 rng(5);
+    const auto graph = random_parity_game(300, 0, 6, rng, {1, 3, false});
+    const auto arena = bitsliced::make_arena(graph);
+
+    // Lane 0 keeps every vertex with player 0, lane 1 gives every vertex to player 1
+    bitsliced::SlicedSet player1(300, 0b10);
+    const auto won0 = bitsliced::solve_parity(arena, player1, bitsliced::first_lanes(2));
+
+    // Ownership only helps its owner: lane 0 dominates lane 1 for player 0
+    for (const auto word : won0) {
+        BOOST_CHECK(!((word >> 1) & 1) || (word & 1));
+    }
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,94 @@
+#include "libggg/graphs/parity_graph.hpp"
+#include "libggg/solvers/bitsliced.hpp"
+#include "libggg/solvers/interleaved.hpp"
+#include "random_games.hpp"
+#include <boost/test/unit_test.hpp>
+#include <random>
+#include <stdexcept>
+#include <vector>
+
+using namespace ggg::graphs;
+namespace bitsliced = ggg::solvers::bitsliced;
+namespace interleaved = ggg::solvers::interleaved;
+using ggg::testing::random_parity_game;
+
+namespace {
+
+/**
+ * @brief Solve that records its steps, suspending steps - 1 times
+ */
+interleaved::Task record(int index, int steps, std::vector<int> &trace) {
+    for (int step = 0; step < steps; ++step) {
+        if (step > 0) {
+            co_await interleaved::prefetch(&trace);
+        }
+        trace.push_back(index);
+    }
+}
+
+interleaved::Task fail() {
+    co_await interleaved::prefetch(nullptr);
+    throw std::runtime_error("solve failed");
+}
+
+} // namespace
+
+BOOST_AUTO_TEST_SUITE(InterleavedTests)
+
+BOOST_AUTO_TEST_CASE(TestRoundRobinAndSlotReuse) {
+    std::vector<int> trace;
+    std::vector<int> slots;
+    const long resumptions = interleaved::run(3, 2, [&](int index, int slot) {
+        slots.push_back(slot);
+        return record(index, index + 1, trace);
+    });
+    // Solve 2 takes the slot solve 0 frees after its only step
+    BOOST_CHECK((slots == std::vector<int>{0, 1, 0}));
+    BOOST_CHECK((trace == std::vector<int>{0, 1, 2, 1, 2, 2}));
+    BOOST_CHECK_EQUAL(resumptions, 6);
+    BOOST_CHECK_EQUAL(interleaved::run(0, 4, [&](int index, int) { return record(index, 1, trace); }), 0);
+}
+
+BOOST_AUTO_TEST_CASE(TestExceptionPropagates) {
+    BOOST_CHECK_THROW(interleaved::run(4, 2, [](int, int) { return fail(); }), std::runtime_error);
+}
+
+BOOST_AUTO_TEST_CASE(TestReachabilityMatchesBitsliced) {
+    std::mt19937_64 rng(17);
+    for (int round = 0; round < 6; ++round) {
+        // Player 0 owns everything in the arena (lanes draw owners); a tenth are targets
+        auto graph = random_parity_game(400, 0, 0, rng, {1, 3, false});
+        std::bernoulli_distribution target_dist(0.1);
+        for (const auto vertex : boost::make_iterator_range(boost::vertices(graph))) {
+            graph[vertex].priority = target_dist(rng) ? 1 : 0;
+        }
+        const auto arena = bitsliced::make_arena(graph);
+        const auto core_lanes = bitsliced::reachability_core(arena);
+        std::vector<int> core;
+        for (int v = 0; v < arena.num_vertices; ++v) {
+            if (core_lanes[v]) {
+                core.push_back(v);
+            }
+        }
+        bitsliced::SlicedSet player1(arena.num_vertices);
+        for (auto &word : player1) {
+            word = rng();
+        }
+        const auto expected = bitsliced::solve_reachability(arena, player1, ~bitsliced::Lanes(0));
+
+        for (const int width : {1, 4, 16}) {
+            std::vector<interleaved::Workspace> workspaces(width);
+            for (int query = 0; query < arena.num_vertices; query += 37) {
+                bool won[bitsliced::lane_count];
+                interleaved::run(bitsliced::lane_count, width, [&](int lane, int slot) {
+                    return interleaved::reachability(arena, player1, lane, core, query, workspaces[slot], won[lane]);
+                });
+                for (int lane = 0; lane < bitsliced::lane_count; ++lane) {
+                    BOOST_CHECK_EQUAL(won[lane], ((expected[query] >> lane) & 1) != 0);
+                }
+            }
+        }
+    }
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,99 @@
+#include "libggg/graphs/parity_graph.hpp"
+#include "libggg/solvers/parity_kernels.hpp"
+#include "random_games.hpp"
+#include <boost/test/unit_test.hpp>
+#include <random>
+#include <vector>
+
+using namespace ggg::graphs;
+using namespace ggg::solvers;
+using namespace ggg::solvers::parity_kernels;
+using ggg::testing::random_parity_game;
+
+namespace {
+
+/**
+ * @brief Check that both winning regions are closed under the winner's moves and traps for the loser
+ */
+void check_strategies(const ParityGraph &graph, const Result &result) {
+    for (const auto v : boost::make_iterator_range(boost::vertices(graph))) {
+        const int winner = result.winner[v];
+        if (graph[v].player == winner) {
+            BOOST_REQUIRE_GE(result.strategy[v], 0);
+            BOOST_CHECK(boost::edge(v, result.strategy[v], graph).second);
+            BOOST_CHECK_EQUAL(result.winner[result.strategy[v]], winner);
+        } else {
+            BOOST_CHECK_EQUAL(result.strategy[v], -1);
+            for (const auto edge : boost::make_iterator_range(boost::out_edges(v, graph))) {
+                BOOST_CHECK_EQUAL(result.winner[boost::target(edge, graph)], winner);
+            }
+        }
+    }
+}
+
+} // namespace
+
+BOOST_AUTO_TEST_SUITE(ParityKernelTests)
+
+BOOST_AUTO_TEST_CASE(TestArenaLevels) {
+    ParityGraph graph;
+    for (const int priority : {3, 5, 8, 10, 13}) {
+        add_vertex(graph, "v" + std::to_string(priority), 0, priority);
+    }
+    for (int v = 0; v < 5; ++v) {
+        add_edge(graph, v, (v + 1) % 5, "");
+    }
+
+    const auto arena = make_arena(graph);
+    BOOST_CHECK_EQUAL(arena.levels, 3);
+    BOOST_CHECK_EQUAL(arena.parity, 1);
+    BOOST_CHECK((arena.level == std::vector<int>{0, 0, 1, 1, 2}));
+}
+
+BOOST_AUTO_TEST_CASE(TestLevelSelection) {
+    int selected = 0;
+    for (const auto &[levels, expected] : {std::pair{1, 2}, std::pair{2, 2}, std::pair{3, 4}, std::pair{4, 4}}) {
+        BOOST_CHECK(with_levels_for(levels, [&](auto kernel) { selected = decltype(kernel)::value; }));
+        BOOST_CHECK_EQUAL(selected, expected);
+    }
+    BOOST_CHECK(!with_levels_for(5, [](auto) {}));
+}
+
+BOOST_AUTO_TEST_CASE(TestLevelsMatchBitboard) {
+    std::mt19937 rng(11);
+    for (int round = 0; round < 40; ++round) {
+        // Priorities {0, 1}, {1, 2}, {0 .. 3} and {1 .. 4}
+        const int min_priority = round % 2;
+        const int max_priority = min_priority + (round % 4 < 2 ? 1 : 3);
+        const auto graph = random_parity_game(120, min_priority, max_priority, rng);
+        const auto expected = solve_bitboard<bitboard::Mask128>(graph);
+        const auto arena = make_arena(graph);
+
+        const auto check = [&](const Result &result) {
+            BOOST_CHECK(result.winner == expected.winner);
+            check_strategies(graph, result);
+        };
+        check(solve_levels<4>(arena));
+        if (arena.levels <= 2) {
+            check(solve_levels<2>(arena));
+        }
+    }
+}
+
+BOOST_AUTO_TEST_CASE(TestLargeGames) {
+    std::mt19937 rng(23);
+    for (int round = 0; round < 6; ++round) {
+        const auto graph = random_parity_game(3000, 0, round % 2 == 0 ? 1 : 3, rng);
+        Result result;
+        BOOST_REQUIRE(solve(graph, result));
+        check_strategies(graph, result);
+        BOOST_CHECK_GT(result.statistics.subgames, 0u);
+    }
+
+    // Too many priorities for the kernels and too many vertices for the bitboards
+    Result result;
+    BOOST_CHECK(!solve(random_parity_game(200, 0, 5, rng), result));
+    BOOST_CHECK(result.winner.empty());
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,72 @@
+#include "libggg/utils/kll_sketch.hpp"
+#include <boost/test/unit_test.hpp>
+#include <algorithm>
+#include <random>
+#include <vector>
+
+using ggg::utils::KllSketch;
+
+BOOST_AUTO_TEST_SUITE(KllSketchTests)
+
+BOOST_AUTO_TEST_CASE(TestExactStatistics) {
+    KllSketch sketch;
+    for (int i = 1; i <= 1000; ++i) {
+        sketch.update(i);
+    }
+    BOOST_CHECK_EQUAL(sketch.count(), 1000u);
+    BOOST_CHECK_CLOSE(sketch.mean(), 500.5, 1e-9);
+    BOOST_CHECK_EQUAL(sketch.min(), 1.0);
+    BOOST_CHECK_EQUAL(sketch.max(), 1000.0);
+    BOOST_CHECK_EQUAL(sketch.quantile(0.0), 1.0);
+    BOOST_CHECK_EQUAL(sketch.quantile(1.0), 1000.0);
+}
+
+BOOST_AUTO_TEST_CASE(TestQuantilesWithBoundedMemory) {
+    std::mt19937_64 rng(1);
+    std::normal_distribution<double> dist(10.0, 3.0);
+    KllSketch sketch(200);
+    std::vector<double> values;
+    for (int i = 0; i < 200000; ++i) {
+        values.push_back(dist(rng));
+        sketch.update(values.back());
+    }
+    std::sort(values.begin(), values.end());
+
+    BOOST_CHECK_LT(sketch.retained(), 2000u);
+    for (const double q : {0.01, 0.1, 0.5, 0.9, 0.99}) {
+        const double estimate = sketch.quantile(q);
+        const double true_rank =
+            static_cast<double>(std::upper_bound(values.begin(), values.end(), estimate) - values.begin()) / values.size();
+        BOOST_CHECK_SMALL(true_rank - q, 0.02);
+    }
+}
+
+BOOST_AUTO_TEST_CASE(TestMergeMatchesSingleStream) {
+    std::mt19937_64 rng(2);
+    std::uniform_real_distribution<double> dist(0.0, 1.0);
+    KllSketch whole;
+    std::vector<KllSketch> parts(4);
+    for (int i = 0; i < 100000; ++i) {
+        const double value = dist(rng);
+        whole.update(value);
+        parts[i % 4].update(value);
+    }
+    KllSketch merged;
+    for (const auto &part : parts) {
+        merged.merge(part);
+    }
+
+    BOOST_CHECK_EQUAL(merged.count(), whole.count());
+    BOOST_CHECK_CLOSE(merged.mean(), whole.mean(), 1e-9);
+    BOOST_CHECK_LT(merged.retained(), 2000u);
+    for (const double q : {0.05, 0.25, 0.5, 0.75, 0.95}) {
+        BOOST_CHECK_SMALL(merged.quantile(q) - q, 0.02);
+    }
+
+    const auto counts = merged.histogram({0.0, 0.5, 1.0});
+    BOOST_REQUIRE_EQUAL(counts.size(), 2u);
+    BOOST_CHECK_CLOSE(counts[0] + counts[1], 100000.0, 1e-6);
+    BOOST_CHECK_SMALL(counts[0] / 100000.0 - 0.5, 0.02);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,135 @@
+#include "libggg/utils/sample_store.hpp"
+#include <boost/test/unit_test.hpp>
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+#include <random>
+#include <string>
+#include <vector>
+
+using ggg::utils::SampleChunk;
+using ggg::utils::SampleStoreReader;
+using ggg::utils::SampleStoreWriter;
+
+namespace {
+std::string temporary_store(const std::string &name) {
+    const auto path = std::filesystem::temp_directory_path() / ("ggg_test_" + name);
+    std::filesystem::remove_all(path);
+    return path.string();
+}
+} // namespace
+
+BOOST_AUTO_TEST_SUITE(SampleStoreTests)
+
+BOOST_AUTO_TEST_CASE(TestRoundTripAcrossChunks) {
+    // 11 vertices and chunk sizes that are not multiples of 8 exercise the bit packing
+    const std::size_t n = 11;
+    const auto directory = temporary_store("round_trip");
+    std::mt19937_64 rng(3);
+    std::vector<std::string> bits;
+    std::vector<bool> outcomes;
+    std::vector<double> values;
+    std::vector<std::uint32_t> times;
+    {
+        SampleStoreWriter writer(directory, n, true);
+        for (const int size : {5, 13, 0, 7}) {
+            SampleChunk chunk(n);
+            for (int i = 0; i < size; ++i) {
+                const bool outcome = rng() & 1;
+                const auto time = static_cast<std::uint32_t>(rng() % 100000);
+                auto *owners = chunk.add_sample(outcome, time);
+                std::string sample(n, '0');
+                for (std::size_t v = 0; v < n; ++v) {
+                    if (rng() & 1) {
+                        owners[v / 8] |= std::uint8_t(1) << (v % 8);
+                        sample[v] = '1';
+                    }
+                }
+                const double value = static_cast<double>(rng() % 1000) / 7.0;
+                chunk.values.push_back(value);
+                bits.push_back(sample);
+                outcomes.push_back(outcome);
+                values.push_back(value);
+                times.push_back(time);
+            }
+            writer.write(chunk);
+        }
+    }
+
+    const SampleStoreReader reader(directory);
+    BOOST_REQUIRE_EQUAL(reader.size(), bits.size());
+    BOOST_CHECK_EQUAL(reader.num_vertices(), n);
+    BOOST_CHECK(reader.has_values());
+    for (std::size_t i = 0; i < bits.size(); ++i) {
+        BOOST_CHECK_EQUAL(reader.bitstring(i), bits[i]);
+        BOOST_CHECK_EQUAL(reader.outcome(i), outcomes[i]);
+        BOOST_CHECK_EQUAL(reader.value(i), values[i]);
+        BOOST_CHECK_EQUAL(reader.time_us(i), times[i]);
+    }
+    std::filesystem::remove_all(directory);
+}
+
+BOOST_AUTO_TEST_CASE(TestStoreWithoutValues) {
+    const auto directory = temporary_store("no_values");
+    {
+        SampleStoreWriter writer(directory, 3, false);
+        SampleChunk chunk(3);
+        chunk.add_sample(true, 12)[0] = 0b101;
+        writer.write(chunk);
+        writer.close();
+    }
+    const SampleStoreReader reader(directory);
+    BOOST_REQUIRE_EQUAL(reader.size(), 1u);
+    BOOST_CHECK(!reader.has_values());
+    BOOST_CHECK_EQUAL(reader.bitstring(0), "101");
+    BOOST_CHECK(reader.outcome(0));
+    BOOST_CHECK_EQUAL(reader.time_us(0), 12u);
+    std::filesystem::remove_all(directory);
+}
+
+BOOST_AUTO_TEST_CASE(TestColumnsAreLittleEndian) {
+    const auto directory = temporary_store("little_endian");
+    {
+        SampleStoreWriter writer(directory, 1, true);
+        SampleChunk chunk(1);
+        chunk.add_sample(false, 0x01020304u);
+        chunk.values.push_back(1.0); // 0x3ff0000000000000
+        writer.write(chunk);
+        writer.close();
+    }
+    const auto bytes = [&](const std::string &name) {
+        std::ifstream file((std::filesystem::path(directory) / name).string(), std::ios::binary);
+        return std::vector<unsigned char>(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+    };
+    BOOST_CHECK((bytes("time_us.bin") == std::vector<unsigned char>{0x04, 0x03, 0x02, 0x01}));
+    BOOST_CHECK((bytes("value.bin") == std::vector<unsigned char>{0, 0, 0, 0, 0, 0, 0xf0, 0x3f}));
+    std::filesystem::remove_all(directory);
+}
+
+BOOST_AUTO_TEST_CASE(TestWriteFailuresThrow) {
+    // A column on a full device fails when written or, at the latest, when closed
+    if (!std::filesystem::exists("/dev/full")) {
+        return;
+    }
+    const auto directory = temporary_store("full");
+    std::filesystem::create_directories(directory);
+    std::filesystem::create_symlink("/dev/full", std::filesystem::path(directory) / "owners.bin");
+    SampleStoreWriter writer(directory, 64, false);
+    SampleChunk chunk(64);
+    for (int i = 0; i < 1000; ++i) {
+        chunk.add_sample(true, 1);
+    }
+    BOOST_CHECK_THROW(
+        {
+            writer.write(chunk);
+            writer.close();
+        },
+        std::runtime_error);
+    std::filesystem::remove_all(directory);
+}
+
+BOOST_AUTO_TEST_CASE(TestMissingStoreThrows) {
+    BOOST_CHECK_THROW(SampleStoreReader(temporary_store("missing")), std::runtime_error);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
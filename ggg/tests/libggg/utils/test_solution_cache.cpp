@@ -0,0 +1,228 @@
+#include "libggg/graphs/discounted_graph.hpp"
+#include "libggg/graphs/parity_graph.hpp"
+#include "libggg/utils/solution_cache.hpp"
+#include <boost/test/unit_test.hpp>
+#include <cmath>
+#include <filesystem>
+#include <fstream>
+#include <limits>
+#include <string>
+#include <vector>
+
+using namespace ggg::graphs;
+using ggg::utils::CachedSolution;
+using ggg::utils::SolutionCache;
+
+namespace {
+std::string temporary_cache(const std::string &name) {
+    const auto path = std::filesystem::temp_directory_path() / ("ggg_test_cache_" + name);
+    std::filesystem::remove_all(path);
+    return path.string();
+}
+
+CachedSolution make_solution(int count, int seed) {
+    CachedSolution solution;
+    for (int v = 0; v < count; ++v) {
+        solution.winners.push_back(static_cast<std::int8_t>((v + seed) % 3 - 1));
+        solution.strategy.push_back((v * 7 + seed) % count - (v % 5 == 0 ? count : 0));
+        solution.values.push_back(v % 4 == 0 ? std::numeric_limits<double>::quiet_NaN() : v * 0.25 - seed);
+    }
+    solution.detail = "seed " + std::to_string(seed);
+    return solution;
+}
+
+void check_equal(const CachedSolution &actual, const CachedSolution &expected) {
+    BOOST_CHECK(actual.winners == expected.winners);
+    BOOST_CHECK(actual.strategy == expected.strategy);
+    BOOST_REQUIRE_EQUAL(actual.values.size(), expected.values.size());
+    for (std::size_t v = 0; v < actual.values.size(); ++v) {
+        if (std::isnan(expected.values[v])) {
+            BOOST_CHECK(std::isnan(actual.values[v]));
+        } else {
+            BOOST_CHECK_EQUAL(actual.values[v], expected.values[v]);
+        }
+    }
+    BOOST_CHECK_EQUAL(actual.detail, expected.detail);
+}
+
+ParityGraph make_cycle(const std::vector<int> &order) {
+    ParityGraph graph;
+    for (int v = 0; v < 4; ++v) {
+        add_vertex(graph, "v" + std::to_string(v), v % 2, v);
+    }
+    for (const int v : order) {
+        add_edge(graph, v, (v + 1) % 4, "e" + std::to_string(v));
+    }
+    return graph;
+}
+} // namespace
+
+BOOST_AUTO_TEST_SUITE(SolutionCacheTests)
+
+BOOST_AUTO_TEST_CASE(TestRoundTripAcrossReopen) {
+    const auto directory = temporary_cache("round_trip");
+    std::vector<ggg::utils::CacheKey> keys;
+    {
+        SolutionCache cache(directory);
+        for (int seed = 0; seed < 20; ++seed) {
+            keys.push_back(SolutionCache::key("game", "solver " + std::to_string(seed)));
+            cache.store(keys.back(), make_solution(1 + seed * 3, seed));
+        }
+        // Winners-only entries (as the sampler stores them) and repeated stores
+        cache.store(SolutionCache::key("game", "winner"), {{1}, {}, {}, {}});
+        cache.store(keys.front(), make_solution(5, 99));
+        BOOST_CHECK_EQUAL(cache.stores(), 21u);
+    }
+
+    SolutionCache cache(directory);
+    BOOST_CHECK_EQUAL(cache.size(), 21u);
+    for (int seed = 0; seed < 20; ++seed) {
+        const auto hit = cache.lookup(keys[seed]);
+        BOOST_REQUIRE(hit.has_value());
+        check_equal(*hit, make_solution(1 + seed * 3, seed));
+    }
+    const auto winner = cache.lookup(SolutionCache::key("game", "winner"));
+    BOOST_REQUIRE(winner.has_value());
+    BOOST_CHECK(winner->winners == std::vector<std::int8_t>{1});
+    BOOST_CHECK(winner->strategy.empty() && winner->values.empty());
+    BOOST_CHECK(!cache.lookup(SolutionCache::key("game", "unknown")).has_value());
+    BOOST_CHECK(!cache.lookup(SolutionCache::key("gam", "esolver 0")).has_value());
+    BOOST_CHECK_EQUAL(cache.hits(), 21u);
+    BOOST_CHECK_EQUAL(cache.misses(), 2u);
+    BOOST_CHECK_THROW(cache.store(keys[0], {{0, 1}, {0}, {}, {}}), std::invalid_argument);
+}
+
+BOOST_AUTO_TEST_CASE(TestConcurrentWriters) {
+    // Two handles on one directory write like two processes: separate segments, one index
+    const auto directory = temporary_cache("concurrent");
+    SolutionCache first(directory);
+    SolutionCache second(directory);
+    for (int seed = 0; seed < 10; ++seed) {
+        first.store(SolutionCache::key("first", std::to_string(seed)), make_solution(8, seed));
+        second.store(SolutionCache::key("second", std::to_string(seed)), make_solution(9, seed));
+    }
+    BOOST_CHECK(!first.lookup(SolutionCache::key("second", "3")).has_value());
+    first.refresh();
+    second.refresh();
+    for (int seed = 0; seed < 10; ++seed) {
+        const auto from_second = first.lookup(SolutionCache::key("second", std::to_string(seed)));
+        const auto from_first = second.lookup(SolutionCache::key("first", std::to_string(seed)));
+        BOOST_REQUIRE(from_second.has_value() && from_first.has_value());
+        check_equal(*from_second, make_solution(9, seed));
+        check_equal(*from_first, make_solution(8, seed));
+    }
+    int segments = 0;
+    for (const auto &file : std::filesystem::directory_iterator(directory)) {
+        segments += file.path().filename().string().rfind("segment-", 0) == 0 ? 1 : 0;
+    }
+    BOOST_CHECK_EQUAL(segments, 2);
+}
+
+BOOST_AUTO_TEST_CASE(TestCorruptionIsAMiss) {
+    const auto directory = temporary_cache("corrupt");
+    const auto key = SolutionCache::key("game", "solver");
+    {
+        SolutionCache cache(directory);
+        cache.store(key, make_solution(16, 1));
+    }
+    for (const auto &file : std::filesystem::directory_iterator(directory)) {
+        if (file.path().filename().string().rfind("segment-", 0) == 0) {
+            std::fstream segment(file.path(), std::ios::in | std::ios::out | std::ios::binary);
+            // Winner pairs are never 0b11, so this byte cannot already hold the value
+            segment.seekp(9);
+            segment.put(static_cast<char>(0xff));
+        }
+    }
+    SolutionCache cache(directory);
+    BOOST_CHECK(!cache.lookup(key).has_value());
+
+    std::ofstream(std::filesystem::path(directory) / "index", std::ios::binary) << "not a cache index";
+    BOOST_CHECK_THROW(SolutionCache{directory}, std::runtime_error);
+}
+
+BOOST_AUTO_TEST_CASE(TestDamagedIndexRecordsAreSkipped) {
+    const auto directory = temporary_cache("torn");
+    const auto index = std::filesystem::path(directory) / "index";
+    std::vector<ggg::utils::CacheKey> keys;
+    {
+        SolutionCache cache(directory);
+        for (int seed = 0; seed < 3; ++seed) {
+            keys.push_back(SolutionCache::key("game", std::to_string(seed)));
+            cache.store(keys.back(), make_solution(6, seed));
+        }
+    }
+    {
+        // Damage the second record (after the 16-byte tag and 48-byte records) and tear a
+        // fourth one off after 20 bytes, as a crash during the append would
+        std::fstream file(index, std::ios::in | std::ios::out | std::ios::binary);
+        file.seekp(16 + 48 + 12);
+        file.put('x');
+        file.seekp(0, std::ios::end);
+        file.write("\x47\x47\x47\x52 torn record ....", 20);
+    }
+
+    SolutionCache cache(directory);
+    BOOST_CHECK_EQUAL(cache.size(), 2u);
+    BOOST_CHECK(cache.lookup(keys[0]).has_value());
+    BOOST_CHECK(!cache.lookup(keys[1]).has_value());
+    BOOST_CHECK(cache.lookup(keys[2]).has_value());
+
+    // Records appended after the torn one are found again
+    const auto later = SolutionCache::key("game", "later");
+    cache.store(later, make_solution(4, 7));
+    SolutionCache reopened(directory);
+    BOOST_CHECK_EQUAL(reopened.size(), 3u);
+    const auto hit = reopened.lookup(later);
+    BOOST_REQUIRE(hit.has_value());
+    check_equal(*hit, make_solution(4, 7));
+}
+
+BOOST_AUTO_TEST_CASE(TestCanonicalGame) {
+    const auto game = ggg::utils::canonical_game(make_cycle({0, 1, 2, 3}));
+    BOOST_CHECK_EQUAL(ggg::utils::canonical_game(make_cycle({3, 1, 0, 2})), game);
+
+    auto renamed = make_cycle({0, 1, 2, 3});
+    renamed[0].name = "start";
+    BOOST_CHECK_EQUAL(ggg::utils::canonical_game(renamed), game);
+    auto reprioritised = renamed;
+    reprioritised[2].priority = 5;
+    BOOST_CHECK(ggg::utils::canonical_game(reprioritised) != game);
+    auto reowned = renamed;
+    reowned[1].player = 0;
+    BOOST_CHECK(ggg::utils::canonical_game(reowned) != game);
+
+    DiscountedGraph discounted;
+    add_vertex(discounted, "a", 0);
+    add_vertex(discounted, "b", 1);
+    add_edge(discounted, 0, 1, "", 1.0, 0.5);
+    add_edge(discounted, 1, 0, "", -2.0, 0.5);
+    const auto before = ggg::utils::canonical_game(discounted);
+    discounted[*boost::edges(discounted).first].discount = 0.9;
+    BOOST_CHECK(ggg::utils::canonical_game(discounted) != before);
+}
+
+BOOST_AUTO_TEST_CASE(TestSolutionCaptureAndRestore) {
+    const auto graph = make_cycle({0, 1, 2, 3});
+    ggg::solvers::RSQSolution<ParityGraph> solution(true);
+    solution.set_winning_player(0, 1);
+    solution.set_winning_player(2, 0);
+    solution.set_strategy(1, 2);
+    solution.set_value(3, -1.5);
+
+    const auto cached = ggg::utils::capture_solution(graph, solution);
+    BOOST_CHECK((cached.winners == std::vector<std::int8_t>{1, -1, 0, -1}));
+    BOOST_CHECK((cached.strategy == std::vector<std::int32_t>{-1, 2, -1, -1}));
+
+    ggg::solvers::RSQSolution<ParityGraph> restored;
+    BOOST_REQUIRE(ggg::utils::restore_solution(graph, cached, restored));
+    BOOST_CHECK(restored.is_solved());
+    BOOST_CHECK(restored.get_winning_regions() == solution.get_winning_regions());
+    BOOST_CHECK(restored.get_strategies() == solution.get_strategies());
+    BOOST_CHECK(restored.get_values() == solution.get_values());
+
+    CachedSolution smaller = cached;
+    smaller.winners.pop_back();
+    BOOST_CHECK(!ggg::utils::restore_solution(graph, smaller, restored));
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,92 @@
+#pragma once
+
+#include "libggg/graphs/discounted_graph.hpp"
+#include "libggg/graphs/mean_payoff_graph.hpp"
+#include "libggg/graphs/parity_graph.hpp"
+#include <random>
+#include <string>
+
+namespace ggg {
+namespace testing {
+
+/**
+ * @brief Shape of a random arena
+ */
+struct ArenaShape {
+    int min_degree = 1;        ///< Fewest successors of a vertex (0 allows dead ends)
+    int max_degree = 3;        ///< Most successors of a vertex
+    bool random_owners = true; ///< Draw owners at random, otherwise every vertex is player 0's
+};
+
+/**
+ * @brief Add num_vertices vertices and uniformly random edges to a game graph
+ *
+ * add_vertex(i, owner) adds vertex i; add_edge(v, w) adds an edge between vertex indices,
+ * so duplicates and self-loops may be drawn.
+ */
+template <typename Rng, typename AddVertex, typename AddEdge>
+void build_random_arena(int num_vertices, const ArenaShape &shape, Rng &rng, AddVertex &&add_vertex, AddEdge &&add_edge) {
+    std::uniform_int_distribution<int> owner_dist(0, shape.random_owners ? 1 : 0);
+    std::uniform_int_distribution<int> vertex_dist(0, num_vertices - 1);
+    std::uniform_int_distribution<int> degree_dist(shape.min_degree, shape.max_degree);
+    for (int i = 0; i < num_vertices; ++i) {
+        add_vertex(i, owner_dist(rng));
+    }
+    for (int i = 0; i < num_vertices; ++i) {
+        for (int j = 0, degree = degree_dist(rng); j < degree; ++j) {
+            add_edge(i, vertex_dist(rng));
+        }
+    }
+}
+
+/**
+ * @brief Random parity game with priorities drawn from [min_priority, max_priority]
+ */
+template <typename Rng>
+graphs::ParityGraph random_parity_game(int num_vertices, int min_priority, int max_priority, Rng &rng,
+                                       const ArenaShape &shape = {}) {
+    graphs::ParityGraph graph;
+    std::uniform_int_distribution<int> priority_dist(min_priority, max_priority);
+    build_random_arena(
+        num_vertices, shape, rng,
+        [&](int i, int owner) { graphs::add_vertex(graph, "v" + std::to_string(i), owner, priority_dist(rng)); },
+        [&](int v, int w) { graphs::add_edge(graph, v, w, ""); });
+    return graph;
+}
+
+/**
+ * @brief Random mean payoff game with integer weights drawn from [min_weight, max_weight]
+ */
+template <typename Rng>
+graphs::MeanPayoffGraph random_mean_payoff_game(int num_vertices, int min_weight, int max_weight, Rng &rng,
+                                                const ArenaShape &shape = {}) {
+    graphs::MeanPayoffGraph graph;
+    std::uniform_int_distribution<int> weight_dist(min_weight, max_weight);
+    build_random_arena(
+        num_vertices, shape, rng,
+        [&](int i, int owner) { graphs::add_vertex(graph, "v" + std::to_string(i), owner, weight_dist(rng)); },
+        [&](int v, int w) { boost::add_edge(v, w, graph); });
+    return graph;
+}
+
+/**
+ * @brief Random discounted game with edge weights in [-10, 10) and discounts in [discount_min, discount_max)
+ */
+template <typename Rng>
+graphs::DiscountedGraph random_discounted_game(int num_vertices, double discount_min, double discount_max, Rng &rng,
+                                               const ArenaShape &shape = {}) {
+    graphs::DiscountedGraph graph;
+    std::uniform_real_distribution<double> weight_dist(-10.0, 10.0);
+    std::uniform_real_distribution<double> discount_dist(discount_min, discount_max);
+    build_random_arena(
+        num_vertices, shape, rng,
+        [&](int i, int owner) { graphs::add_vertex(graph, "v" + std::to_string(i), owner); },
+        [&](int v, int w) {
+            const double weight = weight_dist(rng);
+            graphs::add_edge(graph, v, w, "", weight, discount_dist(rng));
+        });
+    return graph;
+}
+
+} // namespace testing
+} // namespace ggg
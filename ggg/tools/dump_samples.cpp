@@ -0,0 +1,78 @@
+#include "dump_samples.hpp"
+#include "libggg/utils/sample_store.hpp"
+#include <boost/program_options.hpp>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <limits>
+#include <string>
+
+namespace po = boost::program_options;
+
+/**
+ * @brief Tool to convert a columnar sample store to CSV
+ *
+ * Writes one row per sample with its ownership bitstring (character v is the owner of
+ * vertex v), whether player 0 won the query vertex, the query value if the store has
+ * values, and the solve time in microseconds.
+ */
+class DumpSamples {
+  public:
+    /**
+     * @brief Main function for the dump tool
+     */
+    static int run(int argc, char *argv[]) {
+        try {
+            po::options_description desc("Dump Options");
+            desc.add_options()("help,h", "Show help message");
+            desc.add_options()("input,i", po::value<std::string>()->required(), "Sample store directory");
+            desc.add_options()("output,o", po::value<std::string>(), "Output CSV file (default: stdout)");
+
+            po::variables_map vm;
+            po::store(po::parse_command_line(argc, argv, desc), vm);
+
+            if (vm.count("help")) {
+                std::cout << desc << std::endl;
+                return 0;
+            }
+
+            po::notify(vm);
+
+            const ggg::utils::SampleStoreReader store(vm["input"].as<std::string>());
+            if (vm.count("output")) {
+                std::ofstream out(vm["output"].as<std::string>());
+                if (!out.is_open()) {
+                    std::cerr << "Error: Failed to open " << vm["output"].as<std::string>() << std::endl;
+                    return 1;
+                }
+                write_csv(store, out);
+            } else {
+                write_csv(store, std::cout);
+            }
+            return 0;
+
+        } catch (const std::exception &e) {
+            std::cerr << "Error: " << e.what() << std::endl;
+            return 1;
+        }
+    }
+
+  private:
+    static void write_csv(const ggg::utils::SampleStoreReader &store, std::ostream &out) {
+        out << "sample,bits,outcome" << (store.has_values() ? ",value" : "") << ",time_us\n";
+        out << std::setprecision(std::numeric_limits<double>::max_digits10);
+        for (std::size_t i = 0; i < store.size(); ++i) {
+            out << i << "," << store.bitstring(i) << "," << (store.outcome(i) ? 1 : 0);
+            if (store.has_values()) {
+                out << "," << store.value(i);
+            }
+            out << "," << store.time_us(i) << "\n";
+        }
+    }
+};
+
+namespace ggg_tools {
+int run_dump_samples(int argc, char *argv[]) {
+    return DumpSamples::run(argc, argv);
+}
+} // namespace ggg_tools
@@ -0,0 +1,14 @@
+#pragma once
+
+namespace ggg_tools {
+/**
+ * @brief Run the sample store dump tool
+ *
+ * Converts a columnar sample store written by `ggg sample --store` to CSV.
+ *
+ * @param argc Argument count
+ * @param argv Argument values
+ * @return Exit code (0 for success)
+ */
+int run_dump_samples(int argc, char *argv[]);
+} // namespace ggg_tools
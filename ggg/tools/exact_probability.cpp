@@ -0,0 +1,453 @@
+#include "exact_probability.hpp"
+#include "libggg/graphs/parity_graph.hpp"
+#include "libggg/ownership/exact.hpp"
+#include "libggg/ownership/irrelevant.hpp"
+#include "libggg/ownership/objective.hpp"
+#include "libggg/ownership/symmetry.hpp"
+#include "libggg/ownership/tree_decomposition.hpp"
+#include "libggg/utils/solution_cache.hpp"
+#ifdef GGG_PSPM_SOLVER
+#include "progressive_small_progress_measures_solver.hpp"
+#endif
+#ifdef GGG_VALUE_SOLVERS
+#include "libggg/graphs/mean_payoff_graph.hpp"
+#include "mse_solver.hpp"
+#endif
+#include <boost/program_options.hpp>
+#include <bit>
+#include <chrono>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <optional>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+namespace po = boost::program_options;
+namespace bitsliced = ggg::solvers::bitsliced;
+namespace ownership = ggg::ownership;
+
+/**
+ * @brief Tool to compute winning probabilities under random vertex ownership exactly
+ *
+ * Counts the ownership assignments where player 0 wins from the query vertex. Reachability
+ * games are counted by dynamic programming over a min-fill tree decomposition, which
+ * handles sparse arenas far beyond exhaustive enumeration; if the decomposition is too
+ * wide, or for Buchi and parity objectives, the assignments are enumerated with the
+ * bitsliced kernels instead, one per orbit of the arena's automorphisms fixing the query,
+ * skipping the owners of ownership-irrelevant vertices.
+ *
+ * The progress-measures engine enumerates parity games with the progressive small
+ * progress measures solver in Gray-code order: consecutive assignments differ in one
+ * owner, and each solve starts from the measures of the player that gained the flipped
+ * vertex in the previous solve. Mean-payoff games are enumerated the same way with the MSE
+ * energy solver, each solve re-lifting from the previous costs after the single flip.
+ *
+ * With --cache-dir, counts are stored in a solution cache under the arena (owners
+ * cleared), objective and query vertex; every engine counts exactly, so a later run with
+ * any engine reuses them.
+ */
+class ExactProbability {
+  public:
+    /**
+     * @brief Main function for the exact probability tool
+     */
+    static int run(int argc, char *argv[]) {
+        try {
+            po::options_description desc("Exact Probability Options");
+            desc.add_options()("help,h", "Show help message");
+            desc.add_options()("input,i", po::value<std::string>()->required(), "Input parity game (DOT format)");
+            desc.add_options()("objective,g", po::value<std::string>()->default_value("parity"), "Winning condition (parity, buchi, reachability, mean-payoff)");
+            desc.add_options()("vertex", po::value<std::string>()->default_value("v0"), "Name of the query vertex");
+            desc.add_options()("engine,e", po::value<std::string>()->default_value("auto"), "Counting engine (auto, tree-decomposition, enumerate, progress-measures)");
+            desc.add_options()("max-width", po::value<int>()->default_value(10), "Largest tree decomposition width tried before falling back to enumeration");
+            desc.add_options()("no-symmetry", "Enumerate every assignment instead of one per automorphism orbit");
+            desc.add_options()("no-elimination", "Enumerate the owners of ownership-irrelevant vertices too");
+            desc.add_options()("cache-dir", po::value<std::string>(), "Reuse and store counts in this solution cache directory");
+            desc.add_options()("no-warm-start", "Solve every assignment of the progress-measures and mean-payoff enumerations from scratch");
+
+            po::variables_map vm;
+            po::store(po::parse_command_line(argc, argv, desc), vm);
+
+            if (vm.count("help")) {
+                std::cout << desc << std::endl;
+                return 0;
+            }
+
+            po::notify(vm);
+
+            if (vm["objective"].as<std::string>() == "mean-payoff") {
+#ifdef GGG_VALUE_SOLVERS
+                return compute_mean_payoff(vm["input"].as<std::string>(), vm["vertex"].as<std::string>(),
+                                           vm.count("no-warm-start") == 0, cache_dir(vm));
+#else
+                std::cerr << "Error: mean-payoff objectives need the solver libraries (configure with -DBUILD_ALL_SOLVERS=ON)" << std::endl;
+                return 1;
+#endif
+            }
+
+            const auto objective = ownership::parse_objective(vm["objective"].as<std::string>());
+            if (!objective) {
+                std::cerr << "Error: Invalid objective '" << vm["objective"].as<std::string>()
+                          << "'. Valid objectives: parity, buchi, reachability, mean-payoff" << std::endl;
+                return 1;
+            }
+            const std::string engine = vm["engine"].as<std::string>();
+            if (engine != "auto" && engine != "tree-decomposition" && engine != "enumerate" && engine != "progress-measures") {
+                std::cerr << "Error: Invalid engine '" << engine
+                          << "'. Valid engines: auto, tree-decomposition, enumerate, progress-measures" << std::endl;
+                return 1;
+            }
+            if (engine == "tree-decomposition" && *objective != ownership::Objective::Reachability) {
+                std::cerr << "Error: tree-decomposition engine supports reachability objectives only" << std::endl;
+                return 1;
+            }
+            if (engine == "progress-measures") {
+#ifdef GGG_PSPM_SOLVER
+                if (*objective != ownership::Objective::Parity) {
+                    std::cerr << "Error: progress-measures engine supports parity objectives only" << std::endl;
+                    return 1;
+                }
+#else
+                std::cerr << "Error: progress-measures engine needs the solver libraries (configure with -DBUILD_ALL_SOLVERS=ON)" << std::endl;
+                return 1;
+#endif
+            }
+
+            return compute(vm["input"].as<std::string>(), *objective, vm["vertex"].as<std::string>(), engine,
+                           vm["max-width"].as<int>(), vm.count("no-symmetry") == 0,
+                           vm.count("no-elimination") == 0, vm.count("no-warm-start") == 0, cache_dir(vm));
+
+        } catch (const std::exception &e) {
+            std::cerr << "Error: " << e.what() << std::endl;
+            return 1;
+        }
+    }
+
+  private:
+    static std::string cache_dir(const po::variables_map &vm) {
+        return vm.count("cache-dir") ? vm["cache-dir"].as<std::string>() : "";
+    }
+
+    /**
+     * @brief Cached counts of one arena, objective and query vertex
+     *
+     * The entry holds no winners, only "wins total engine" as its detail, since the counts
+     * can exceed a double.
+     */
+    class CountCache {
+      public:
+        template <typename GraphType>
+        CountCache(const std::string &directory, const GraphType &graph, const std::string &objective, int query) {
+            if (directory.empty()) {
+                return;
+            }
+            GraphType arena = graph;
+            for (const auto v : boost::make_iterator_range(boost::vertices(arena))) {
+                arena[v].player = 0;
+            }
+            cache_ = std::make_unique<ggg::utils::SolutionCache>(directory);
+            key_ = ggg::utils::SolutionCache::key(ggg::utils::canonical_game(arena),
+                                                  "exact/" + objective + "/query=" + std::to_string(query));
+        }
+
+        /**
+         * @brief The stored counts (with their engine), if any
+         */
+        std::optional<ownership::ExactResult> lookup() {
+            if (!cache_) {
+                return std::nullopt;
+            }
+            const auto hit = cache_->lookup(key_);
+            if (!hit) {
+                return std::nullopt;
+            }
+            std::istringstream detail(hit->detail);
+            ownership::ExactResult result;
+            if (!(detail >> result.wins >> result.total) || !std::getline(detail >> std::ws, result.engine)) {
+                return std::nullopt;
+            }
+            return result;
+        }
+
+        void store(const ownership::ExactResult &result) {
+            if (cache_) {
+                std::ostringstream detail;
+                detail << result.wins << " " << result.total << " " << result.engine;
+                cache_->store(key_, {{}, {}, {}, detail.str()});
+            }
+        }
+
+      private:
+        std::unique_ptr<ggg::utils::SolutionCache> cache_;
+        ggg::utils::CacheKey key_;
+    };
+
+    /**
+     * @brief Print the counts served from the cache
+     */
+    static int report_cached(const ownership::ExactResult &result, double time_ms) {
+        std::cout << "Engine: " << result.engine << " (cached)" << std::endl;
+        std::cout << "Winning assignments: " << result.wins << "/" << result.total << std::endl;
+        std::cout << "Probability: " << std::setprecision(10) << result.probability() << std::endl;
+        std::cout << "Time: " << std::fixed << std::setprecision(3) << time_ms << " ms" << std::endl;
+        return 0;
+    }
+
+    /**
+     * @brief Count the winning assignments and print the result
+     */
+    static int compute(const std::string &input, ownership::Objective objective, const std::string &vertex,
+                       const std::string &engine, int max_width, bool symmetry,
+                       bool elimination, bool warm_start, const std::string &cache_directory) {
+        const auto graph = ggg::graphs::parse_Parity_graph(input);
+        if (!graph) {
+            std::cerr << "Error: Failed to parse game from " << input << std::endl;
+            return 1;
+        }
+
+        const int num_vertices = static_cast<int>(boost::num_vertices(*graph));
+        int query = -1;
+        for (int v = 0; v < num_vertices; ++v) {
+            if ((*graph)[v].name == vertex) {
+                query = v;
+                break;
+            }
+        }
+        if (query < 0) {
+            std::cerr << "Error: Vertex '" << vertex << "' not found in " << input << std::endl;
+            return 1;
+        }
+        if (objective != ownership::Objective::Parity) {
+            for (int v = 0; v < num_vertices; ++v) {
+                if ((*graph)[v].priority != 0 && (*graph)[v].priority != 1) {
+                    std::cerr << "Error: " << ownership::to_string(objective) << " games need priorities 0 or 1" << std::endl;
+                    return 1;
+                }
+            }
+        }
+
+        const auto start = std::chrono::steady_clock::now();
+        CountCache cache(cache_directory, *graph, ownership::to_string(objective), query);
+        if (const auto cached = cache.lookup()) {
+            return report_cached(*cached, std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count());
+        }
+        const auto arena = bitsliced::make_arena(*graph);
+
+        std::optional<ownership::ExactResult> result;
+        int width = -1;
+        if (objective == ownership::Objective::Reachability && engine != "enumerate") {
+            const auto order = ownership::min_fill_order(arena, max_width);
+            if (static_cast<int>(order.order.size()) < num_vertices) {
+                // The heuristic stopped at the first bag over the limit
+                std::cout << "Tree decomposition width: over " << max_width << std::endl;
+            } else {
+                width = order.width;
+                std::cout << "Tree decomposition width: " << width << std::endl;
+            }
+            result = ownership::reachability_by_elimination(arena, query, order, max_width);
+            if (!result) {
+                if (engine == "tree-decomposition") {
+                    std::cerr << "Error: Tree decomposition exceeds the width, table or work limits" << std::endl;
+                    return 1;
+                }
+                std::cout << "Tree decomposition too large, falling back to enumeration" << std::endl;
+            }
+        }
+        std::vector<char> pinned(num_vertices, 0);
+        if (!result && elimination) {
+            auto irrelevant = ownership::irrelevant_vertices(arena, objective);
+            std::cout << "Ownership-irrelevant vertices: " << irrelevant.count << " (bits eliminated)" << std::endl;
+            pinned = std::move(irrelevant.irrelevant);
+        }
+#ifdef GGG_PSPM_SOLVER
+        if (engine == "progress-measures") {
+            result = enumerate_progress_measures(*graph, query, pinned, warm_start);
+        }
+#endif
+        if (!result && symmetry) {
+            const auto group = ownership::automorphism_group(arena, query);
+            std::cout << "Automorphism group order: " << group.order << " (" << group.generators.size()
+                      << " generators, " << group.moved.size() << " vertices moved)" << std::endl;
+            if (!group.generators.empty()) {
+                result = ownership::enumerate_symmetric(arena, objective, query, group, pinned);
+            }
+        }
+        if (!result) {
+            result = ownership::enumerate(arena, objective, query, pinned);
+        }
+        result->width = width;
+        cache.store(*result);
+        const double time_ms = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+
+        std::cout << "Engine: " << result->engine << std::endl;
+        if (result->solved > 0) {
+            std::cout << "Assignments solved: " << result->solved << std::endl;
+        }
+        std::cout << "Winning assignments: " << result->wins << "/" << result->total << std::endl;
+        std::cout << "Probability: " << std::setprecision(10) << result->probability() << std::endl;
+        std::cout << "Time: " << std::fixed << std::setprecision(3) << time_ms << " ms" << std::endl;
+        return 0;
+    }
+
+#ifdef GGG_VALUE_SOLVERS
+    /**
+     * @brief Count the assignments where player 0 wins a mean-payoff game, in Gray-code order
+     *
+     * Step i flips the owner of the vertex indexed by the lowest set bit of i, and the MSE
+     * solver re-lifts from the previous costs (see MSESolver::solve_after_flip).
+     */
+    static int compute_mean_payoff(const std::string &input, const std::string &vertex, bool warm_start,
+                                   const std::string &cache_directory) {
+        auto graph = ggg::graphs::parse_MeanPayoff_graph(input);
+        if (!graph) {
+            std::cerr << "Error: Failed to parse game from " << input << std::endl;
+            return 1;
+        }
+        const int n = static_cast<int>(boost::num_vertices(*graph));
+        int query = -1;
+        for (int v = 0; v < n; ++v) {
+            if ((*graph)[v].name == vertex) {
+                query = v;
+                break;
+            }
+        }
+        if (query < 0) {
+            std::cerr << "Error: Vertex '" << vertex << "' not found in " << input << std::endl;
+            return 1;
+        }
+        if (n > ownership::max_enumeration_vertices) {
+            std::cerr << "Error: Enumeration supports at most " << ownership::max_enumeration_vertices << " vertices" << std::endl;
+            return 1;
+        }
+
+        const auto start = std::chrono::steady_clock::now();
+        CountCache cache(cache_directory, *graph, "mean-payoff", query);
+        if (const auto cached = cache.lookup()) {
+            return report_cached(*cached, std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count());
+        }
+        for (int v = 0; v < n; ++v) {
+            (*graph)[v].player = 0;
+        }
+        ggg::solvers::MSESolver solver;
+        std::uint64_t wins = 0;
+        std::int64_t iterations = 0;
+        const std::uint64_t assignments = std::uint64_t(1) << n;
+        for (std::uint64_t step = 0; step < assignments; ++step) {
+            ggg::solvers::SolutionType solution;
+            if (step == 0) {
+                solution = solver.solve(*graph);
+            } else {
+                const int flipped = std::countr_zero(step);
+                (*graph)[flipped].player = 1 - (*graph)[flipped].player;
+                solution = warm_start ? solver.solve_after_flip(*graph, flipped) : solver.solve(*graph);
+            }
+            iterations += solver.get_iterations();
+            wins += solution.get_winning_player(query) == 0 ? 1 : 0;
+        }
+        ownership::ExactResult result;
+        result.wins = wins;
+        result.total = assignments;
+        result.engine = warm_start ? "mse-gray-code" : "mse";
+        cache.store(result);
+        const double time_ms = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+
+        std::cout << "Engine: " << result.engine << std::endl;
+        std::cout << "Lifting iterations: " << iterations << " (" << std::fixed << std::setprecision(1)
+                  << static_cast<double>(iterations) / static_cast<double>(assignments) << " per assignment)"
+                  << std::defaultfloat << std::endl;
+        std::cout << "Winning assignments: " << wins << "/" << assignments << std::endl;
+        std::cout << "Probability: " << std::setprecision(10)
+                  << static_cast<double>(wins) / static_cast<double>(assignments) << std::endl;
+        std::cout << "Time: " << std::fixed << std::setprecision(3) << time_ms << " ms" << std::endl;
+        return 0;
+    }
+#endif
+
+#ifdef GGG_PSPM_SOLVER
+    /**
+     * @brief Count winning assignments with the progress measures solver in Gray-code order
+     *
+     * Step i flips the owner of the free vertex indexed by the lowest set bit of i. Owning
+     * more vertices never lowers a player's least progress measures, so the previous
+     * measures of the player gaining the vertex are a valid start for the next solve.
+     * Only certified solves are counted: a warm solve the solver does not certify is
+     * repeated cold, and if that is not certified either, the caller enumerates instead.
+     *
+     * @param graph Parity game (owners are overwritten)
+     * @param query Query vertex
+     * @param pinned Vertices left with player 0
+     * @param warm_start Whether to seed each solve with the previous measures
+     * @return The count, or nothing if some assignment could not be solved with certainty
+     */
+    static std::optional<ownership::ExactResult> enumerate_progress_measures(ggg::graphs::ParityGraph graph, int query,
+                                                                             const std::vector<char> &pinned, bool warm_start) {
+        const int n = static_cast<int>(boost::num_vertices(graph));
+        std::vector<int> free;
+        for (int v = 0; v < n; ++v) {
+            graph[v].player = 0;
+            if (!pinned[v]) {
+                free.push_back(v);
+            }
+        }
+        const int f = static_cast<int>(free.size());
+        if (f > ownership::max_enumeration_vertices) {
+            throw std::invalid_argument("Enumeration supports at most " + std::to_string(ownership::max_enumeration_vertices) +
+                                        " free vertices, arena has " + std::to_string(f));
+        }
+
+        ggg::solvers::ProgressiveSmallProgressMeasuresSolver solver;
+        std::uint64_t wins = 0;
+        std::uint64_t resolved = 0;
+        std::int64_t lifts = 0;
+        std::vector<int> measures;
+        const std::uint64_t assignments = std::uint64_t(1) << f;
+        for (std::uint64_t step = 0; step < assignments; ++step) {
+            int flipped = -1;
+            if (step > 0) {
+                flipped = free[std::countr_zero(step)];
+                graph[flipped].player = 1 - graph[flipped].player;
+            }
+            ggg::solvers::RSSolution<ggg::graphs::ParityGraph> solution;
+            if (flipped >= 0 && warm_start) {
+                measures = solver.get_measures();
+                solution = solver.solve(graph, measures, graph[flipped].player);
+            } else {
+                solution = solver.solve(graph);
+            }
+            lifts += solver.get_lift_attempts();
+            if (!solution.is_solved() && flipped >= 0 && warm_start) {
+                solution = solver.solve(graph);
+                lifts += solver.get_lift_attempts();
+                resolved++;
+            }
+            if (!solution.is_solved()) {
+                std::cout << "Progress measures solve not certified, falling back to enumeration" << std::endl;
+                return std::nullopt;
+            }
+            wins += solution.get_winning_player(query) == 0 ? 1 : 0;
+        }
+        std::cout << "Lift attempts: " << lifts << " (" << std::fixed << std::setprecision(1)
+                  << static_cast<double>(lifts) / static_cast<double>(assignments) << " per assignment)"
+                  << std::defaultfloat << std::endl;
+        if (resolved > 0) {
+            std::cout << "Uncertified warm starts re-solved cold: " << resolved << std::endl;
+        }
+
+        ownership::ExactResult result;
+        result.wins = ownership::Count(wins) << (n - f);
+        result.total = ownership::Count(1) << n;
+        result.solved = assignments;
+        result.engine = warm_start ? "progress-measures-gray-code" : "progress-measures";
+        return result;
+    }
+#endif
+};
+
+namespace ggg_tools {
+int run_exact_probability(int argc, char *argv[]) {
+    return ExactProbability::run(argc, argv);
+}
+} // namespace ggg_tools
@@ -0,0 +1,15 @@
+#pragma once
+
+namespace ggg_tools {
+/**
+ * @brief Run the exact win-probability tool
+ *
+ * Computes the exact probability that player 0 wins from a query vertex when every
+ * vertex owner is drawn uniformly at random.
+ *
+ * @param argc Argument count
+ * @param argv Argument values
+ * @return Exit code (0 for success)
+ */
+int run_exact_probability(int argc, char *argv[]);
+} // namespace ggg_tools
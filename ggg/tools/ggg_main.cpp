@@ -10,8 +10,11 @@
 
 // Include tool headers
 #include "benchmark_solvers.hpp"
+#include "dump_samples.hpp"
+#include "exact_probability.hpp"
 #include "generate_games.hpp"
 #include "list_solvers.hpp"
+#include "sample_games.hpp"
 
 namespace po = boost::program_options;
 namespace fs = boost::filesystem;
@@ -29,8 +32,11 @@ void show_help() {
     std::cout << "  -q                        Decrease verbosity (quiet mode)\n\n";
     std::cout << "Available subcommands:\n";
     std::cout << "  benchmark     Run benchmark tests on solvers\n";
+    std::cout << "  dump          Convert a sample store to CSV\n";
+    std::cout << "  exact         Compute winning probabilities under random ownership exactly\n";
     std::cout << "  generate      Generate random game graphs\n";
     std::cout << "  list-solvers  List available solvers for a game type\n";
+    std::cout << "  sample        Estimate winning probabilities under random ownership\n";
     std::cout << "\nUse 'ggg <subcommand> --help' for help on a specific subcommand.\n";
 }
 
@@ -83,6 +89,48 @@ int handle_generate(const std::vector<std::string> &args) {
     return ggg_tools::run_generate_games(c_args.size(), c_args.data());
 }
 
+/**
+ * @brief Handle dump subcommand
+ */
+int handle_dump(const std::vector<std::string> &args) {
+    // Convert back to argc/argv format
+    std::vector<char *> c_args;
+    c_args.push_back(const_cast<char *>("ggg dump"));
+    for (const auto &arg : args) {
+        c_args.push_back(const_cast<char *>(arg.c_str()));
+    }
+
+    return ggg_tools::run_dump_samples(c_args.size(), c_args.data());
+}
+
+/**
+ * @brief Handle exact subcommand
+ */
+int handle_exact(const std::vector<std::string> &args) {
+    // Convert back to argc/argv format
+    std::vector<char *> c_args;
+    c_args.push_back(const_cast<char *>("ggg exact"));
+    for (const auto &arg : args) {
+        c_args.push_back(const_cast<char *>(arg.c_str()));
+    }
+
+    return ggg_tools::run_exact_probability(c_args.size(), c_args.data());
+}
+
+/**
+ * @brief Handle sample subcommand
+ */
+int handle_sample(const std::vector<std::string> &args) {
+    // Convert back to argc/argv format
+    std::vector<char *> c_args;
+    c_args.push_back(const_cast<char *>("ggg sample"));
+    for (const auto &arg : args) {
+        c_args.push_back(const_cast<char *>(arg.c_str()));
+    }
+
+    return ggg_tools::run_sample_games(c_args.size(), c_args.data());
+}
+
 int main(int argc, char *argv[]) {
     try {
         // Convert to vector for easier handling
@@ -135,11 +183,16 @@ int main(int argc, char *argv[]) {
 
         if (subcommand == "benchmark") {
             return handle_benchmark(sub_args);
+        } else if (subcommand == "dump") {
+            return handle_dump(sub_args);
+        } else if (subcommand == "exact") {
+            return handle_exact(sub_args);
         } else if (subcommand == "generate") {
             return handle_generate(sub_args);
         } else if (subcommand == "list-solvers") {
             return handle_list_solvers(sub_args);
-
+        } else if (subcommand == "sample") {
+            return handle_sample(sub_args);
         } else {
             std::cerr << "Error: Unknown subcommand '" << subcommand << "'\n\n";
             show_help();
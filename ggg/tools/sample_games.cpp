@@ -0,0 +1,997 @@
+#include "sample_games.hpp"
+#include "libggg/graphs/discounted_graph.hpp"
+#include "libggg/graphs/mean_payoff_graph.hpp"
+#include "libggg/graphs/parity_graph.hpp"
+#include "libggg/graphs/stochastic_discounted_graph.hpp"
+#include "libggg/ownership/design.hpp"
+#include "libggg/ownership/irrelevant.hpp"
+#include "libggg/ownership/objective.hpp"
+#include "libggg/ownership/perturbation.hpp"
+#include "libggg/ownership/rare_event.hpp"
+#include "libggg/solvers/bitboard.hpp"
+#include "libggg/solvers/bitsliced.hpp"
+#include "libggg/solvers/interleaved.hpp"
+#include "libggg/solvers/value_lanes.hpp"
+#include "libggg/utils/kll_sketch.hpp"
+#include "libggg/utils/sample_store.hpp"
+#include "libggg/utils/solution_cache.hpp"
+#ifdef GGG_VALUE_SOLVERS
+#include "discounted_value_solver.hpp"
+#include "mse_solver.hpp"
+#include "stochastic_discounted_value_solver.hpp"
+#endif
+#include <boost/program_options.hpp>
+#include <array>
+#include <bit>
+#include <chrono>
+#include <cmath>
+#include <fstream>
+#include <functional>
+#include <iomanip>
+#include <iostream>
+#include <limits>
+#include <memory>
+#include <optional>
+#include <random>
+#include <string>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+namespace po = boost::program_options;
+namespace bitboard = ggg::solvers::bitboard;
+namespace bitsliced = ggg::solvers::bitsliced;
+
+/**
+ * @brief Tool to estimate winning probabilities under random vertex ownership
+ *
+ * Reads one arena and repeatedly redraws the owner of every vertex uniformly at
+ * random, counting the assignments where player 0 wins from the query vertex. This is
+ * the in-process replacement of the fpraas-*.py experiment scripts: assignments are
+ * drawn 64 at a time as one random word per vertex and solved by the bitsliced kernels
+ * (or lane by lane with the bitboard kernels). Besides i.i.d. draws, --design selects
+ * antithetic, balanced or Sobol-derived assignments; their standard error is computed
+ * from the spread between blocks of the design, and the design effect reports how many
+ * i.i.d. samples the run is worth. For tiny probabilities, --estimator cross-entropy
+ * tunes per-vertex owner biases over a few levels and reports the likelihood-weighted win
+ * frequency of the final biased samples with its relative error.
+ *
+ * --edge-probability and --priority-jitter also perturb the arena per sample: each edge is
+ * kept with the given probability (redrawn where a vertex would lose all of its edges)
+ * and priorities are shifted by uniform offsets. Both are drawn per lane into a
+ * bitsliced::Overlay, so the bitsliced kernels solve perturbed batches without
+ * rebuilding the arena.
+ *
+ * Discounted, stochastic discounted, mean-payoff and energy games are sampled with the
+ * value solvers; the query vertex's value (discounted value, or minimal initial credit of
+ * the MSE energy reduction) is fed into a KLL quantile sketch per thread, and the sketches
+ * are merged for the report, so memory stays bounded however many samples are drawn.
+ * Chance vertices of stochastic games keep player -1; --random-probabilities also redraws
+ * every chance distribution uniformly from the simplex per sample. Discounted and
+ * stochastic discounted samples are solved eight at a time in the SIMD lanes of
+ * value_lanes::iterate (to the default value iteration tolerance); with redrawn
+ * probabilities every sample is swept on its own, and --engine solver solves samples one
+ * at a time with the exact worklist solver.
+ *
+ * --cache-dir looks every sample up in a persistent solution cache before solving it, keyed
+ * by the arena, objective, query vertex and the sample's ownership, and stores the samples
+ * it had to solve, so repeated runs with the same seed only pay for the lookups.
+ */
+class OwnershipSampler {
+  public:
+    /**
+     * @brief Main function for the sampler tool
+     */
+    static int run(int argc, char *argv[]) {
+        try {
+            po::options_description desc("Ownership Sampler Options");
+            desc.add_options()("help,h", "Show help message");
+            desc.add_options()("input,i", po::value<std::string>()->required(), "Input game (DOT format)");
+            desc.add_options()("objective,g", po::value<std::string>()->default_value("parity"), "Winning condition (parity, buchi, reachability) or value objective (discounted, stochastic-discounted, mean-payoff, energy)");
+            desc.add_options()("samples,n", po::value<long>()->default_value(100000), "Number of ownership assignments to sample");
+            desc.add_options()("vertex", po::value<std::string>()->default_value("v0"), "Name of the query vertex");
+            desc.add_options()("engine,e", po::value<std::string>()->default_value("auto"), "Solving engine (auto, bitsliced, bitboard, interleaved; solver solves discounted samples one at a time)");
+            desc.add_options()("in-flight", po::value<int>()->default_value(8), "Reachability solves interleaved per thread by the interleaved engine");
+            desc.add_options()("random-probabilities", "Also redraw the distribution of every chance vertex uniformly per sample (stochastic-discounted)");
+            desc.add_options()("design,d", po::value<std::string>()->default_value("iid"), "Sampling design (iid, antithetic, balanced, sobol)");
+            desc.add_options()("estimator", po::value<std::string>()->default_value("monte-carlo"), "Estimator (monte-carlo, cross-entropy); cross-entropy suits tiny probabilities and uses the bitsliced kernels");
+            desc.add_options()("level-samples", po::value<long>()->default_value(10000), "Samples per cross-entropy level (the final estimate uses --samples)");
+            desc.add_options()("rarity", po::value<double>()->default_value(0.1), "Elite fraction per cross-entropy level");
+            desc.add_options()("seed,s", po::value<unsigned int>(), "Random seed (default: random)");
+            desc.add_options()("report-every", po::value<long>()->default_value(1000), "Print progress every this many samples (0 to disable)");
+            desc.add_options()("log,l", po::value<std::string>(), "Write \"wins/solved; time_ms\" progress lines to this file");
+            desc.add_options()("store", po::value<std::string>(), "Write per-sample owners, outcomes, values and times to this columnar store directory");
+            desc.add_options()("threads,t", po::value<int>()->default_value(1), "Worker threads for value objectives");
+            desc.add_options()("bins", po::value<int>()->default_value(10), "Histogram bins reported for value objectives");
+            desc.add_options()("edge-probability", po::value<double>()->default_value(1.0), "Keep every edge with this probability per sample (no new dead ends)");
+            desc.add_options()("priority-jitter", po::value<int>()->default_value(0), "Shift every priority by a uniform offset in [-jitter, jitter] per sample (parity)");
+            desc.add_options()("cache-dir", po::value<std::string>(), "Reuse and store per-sample outcomes in this solution cache directory");
+            desc.add_options()("no-prefilter", "Sample even when the outcome, or the owner of a vertex, does not matter");
+
+            po::variables_map vm;
+            po::store(po::parse_command_line(argc, argv, desc), vm);
+
+            if (vm.count("help")) {
+                std::cout << desc << std::endl;
+                return 0;
+            }
+
+            po::notify(vm);
+
+            Options options;
+            options.input = vm["input"].as<std::string>();
+            options.objective = vm["objective"].as<std::string>();
+            options.samples = vm["samples"].as<long>();
+            options.vertex = vm["vertex"].as<std::string>();
+            options.engine = vm["engine"].as<std::string>();
+            options.in_flight = vm["in-flight"].as<int>();
+            const auto design = ggg::ownership::parse_design(vm["design"].as<std::string>());
+            if (!design) {
+                std::cerr << "Error: Invalid design '" << vm["design"].as<std::string>()
+                          << "'. Valid designs: iid, antithetic, balanced, sobol" << std::endl;
+                return 1;
+            }
+            options.design = *design;
+            options.estimator = vm["estimator"].as<std::string>();
+            options.level_samples = vm["level-samples"].as<long>();
+            options.rarity = vm["rarity"].as<double>();
+            options.seed = vm.count("seed") ? vm["seed"].as<unsigned int>() : std::random_device{}();
+            options.report_every = vm["report-every"].as<long>();
+            options.log = vm.count("log") ? vm["log"].as<std::string>() : "";
+            options.prefilter = vm.count("no-prefilter") == 0;
+            options.store = vm.count("store") ? vm["store"].as<std::string>() : "";
+            options.threads = vm["threads"].as<int>();
+            options.bins = vm["bins"].as<int>();
+            options.random_probabilities = vm.count("random-probabilities") > 0;
+            options.edge_probability = vm["edge-probability"].as<double>();
+            options.priority_jitter = vm["priority-jitter"].as<int>();
+            options.cache_dir = vm.count("cache-dir") ? vm["cache-dir"].as<std::string>() : "";
+
+            const bool value_objective = options.objective == "discounted" || options.objective == "stochastic-discounted" ||
+                                         options.objective == "mean-payoff" || options.objective == "energy";
+            if (options.objective != "parity" && options.objective != "buchi" && options.objective != "reachability" &&
+                !value_objective) {
+                std::cerr << "Error: Invalid objective '" << options.objective
+                          << "'. Valid objectives: parity, buchi, reachability, discounted, stochastic-discounted, mean-payoff, energy"
+                          << std::endl;
+                return 1;
+            }
+            if (options.engine != "auto" && options.engine != "bitsliced" && options.engine != "bitboard" &&
+                options.engine != "interleaved" && options.engine != "solver") {
+                std::cerr << "Error: Invalid engine '" << options.engine
+                          << "'. Valid engines: auto, bitsliced, bitboard, interleaved, solver" << std::endl;
+                return 1;
+            }
+            if (options.engine == "interleaved" && (options.objective != "reachability" || options.perturbed() || options.in_flight < 1)) {
+                std::cerr << "Error: interleaved engine supports the reachability objective only, without perturbations, "
+                          << "and in-flight must be at least 1" << std::endl;
+                return 1;
+            }
+            if (options.engine == "solver" && !value_objective) {
+                std::cerr << "Error: solver engine supports value objectives only" << std::endl;
+                return 1;
+            }
+            if (options.random_probabilities && options.objective != "stochastic-discounted") {
+                std::cerr << "Error: random-probabilities supports the stochastic-discounted objective only" << std::endl;
+                return 1;
+            }
+            if (options.edge_probability <= 0.0 || options.edge_probability > 1.0 || options.priority_jitter < 0) {
+                std::cerr << "Error: edge-probability must be in (0, 1] and priority-jitter at least 0" << std::endl;
+                return 1;
+            }
+            if (options.perturbed() && (value_objective || options.engine == "bitboard" || options.estimator == "cross-entropy" ||
+                                        !options.store.empty())) {
+                std::cerr << "Error: edge-probability and priority-jitter need the bitsliced engine and the monte-carlo "
+                          << "estimator, without value objectives or --store" << std::endl;
+                return 1;
+            }
+            if (!options.cache_dir.empty() && (options.perturbed() || options.random_probabilities || options.estimator == "cross-entropy")) {
+                std::cerr << "Error: cache-dir needs the monte-carlo estimator, without edge-probability, priority-jitter "
+                          << "or random-probabilities" << std::endl;
+                return 1;
+            }
+            if (options.priority_jitter > 0 && options.objective != "parity") {
+                std::cerr << "Error: priority-jitter supports the parity objective only" << std::endl;
+                return 1;
+            }
+            if (options.estimator != "monte-carlo" && options.estimator != "cross-entropy") {
+                std::cerr << "Error: Invalid estimator '" << options.estimator
+                          << "'. Valid estimators: monte-carlo, cross-entropy" << std::endl;
+                return 1;
+            }
+            if (options.estimator == "cross-entropy") {
+                if (value_objective || options.design != ggg::ownership::Design::Iid || !options.store.empty()) {
+                    std::cerr << "Error: cross-entropy estimator supports parity, buchi and reachability objectives only, "
+                              << "without --design or --store" << std::endl;
+                    return 1;
+                }
+                if (options.level_samples < 1 || options.rarity <= 0.0 || options.rarity >= 1.0) {
+                    std::cerr << "Error: level-samples must be at least 1 and rarity in (0, 1)" << std::endl;
+                    return 1;
+                }
+            }
+            if (options.samples < 1) {
+                std::cerr << "Error: samples must be at least 1" << std::endl;
+                return 1;
+            }
+            if (options.threads < 1 || options.bins < 1) {
+                std::cerr << "Error: threads and bins must be at least 1" << std::endl;
+                return 1;
+            }
+
+            if (value_objective) {
+#ifdef GGG_VALUE_SOLVERS
+                if (options.objective == "discounted") {
+                    return sample_values<ggg::graphs::DiscountedGraph, ggg::solvers::DiscountedValueSolver>(
+                        options, ggg::graphs::parse_Discounted_graph(options.input));
+                }
+                if (options.objective == "stochastic-discounted") {
+                    return sample_values<ggg::graphs::Stochastic_DiscountedGraph, ggg::solvers::StochasticDiscountedValueSolver>(
+                        options, ggg::graphs::parse_Stochastic_Discounted_graph(options.input));
+                }
+                // Energy games are mean-payoff arenas whose value is the minimal initial credit
+                return sample_values<ggg::graphs::MeanPayoffGraph, ggg::solvers::MSESolver>(
+                    options, ggg::graphs::parse_MeanPayoff_graph(options.input));
+#else
+                std::cerr << "Error: value objectives need the solver libraries (configure with -DBUILD_ALL_SOLVERS=ON)" << std::endl;
+                return 1;
+#endif
+            }
+
+            return sample(options);
+
+        } catch (const std::exception &e) {
+            std::cerr << "Error: " << e.what() << std::endl;
+            return 1;
+        }
+    }
+
+  private:
+    struct Options {
+        std::string input;
+        std::string objective;
+        long samples = 0;
+        std::string vertex;
+        std::string engine;
+        int in_flight = 8;
+        ggg::ownership::Design design = ggg::ownership::Design::Iid;
+        std::string estimator;
+        long level_samples = 0;
+        double rarity = 0.1;
+        unsigned int seed = 0;
+        long report_every = 0;
+        std::string log;
+        bool prefilter = true;
+        std::string store;
+        int threads = 1;
+        int bins = 10;
+        bool random_probabilities = false;
+        double edge_probability = 1.0;
+        int priority_jitter = 0;
+        std::string cache_dir;
+
+        /**
+         * @brief Whether the arena itself is redrawn per sample
+         */
+        bool perturbed() const { return edge_probability < 1.0 || priority_jitter > 0; }
+    };
+
+    /**
+     * @brief Solves a batch of up to 64 assignments, optionally over perturbed arenas; returns the lanes where player 0 wins the query vertex
+     */
+    using BatchSolver = std::function<bitsliced::Lanes(const bitsliced::SlicedSet &player1, bitsliced::Lanes lanes,
+                                                       const bitsliced::Overlay *overlay)>;
+
+    /**
+     * @brief Samples buffered per thread before a chunk is appended to the store
+     */
+    static constexpr std::size_t store_chunk = 1 << 16;
+
+    /**
+     * @brief Run the sampling loop
+     */
+    static int sample(const Options &options) {
+        const auto graph = ggg::graphs::parse_Parity_graph(options.input);
+        if (!graph) {
+            std::cerr << "Error: Failed to parse game from " << options.input << std::endl;
+            return 1;
+        }
+
+        const int num_vertices = static_cast<int>(boost::num_vertices(*graph));
+        int query = -1;
+        for (int v = 0; v < num_vertices; ++v) {
+            if ((*graph)[v].name == options.vertex) {
+                query = v;
+                break;
+            }
+        }
+        if (query < 0) {
+            std::cerr << "Error: Vertex '" << options.vertex << "' not found in " << options.input << std::endl;
+            return 1;
+        }
+
+        if (options.objective != "parity") {
+            for (int v = 0; v < num_vertices; ++v) {
+                if ((*graph)[v].priority != 0 && (*graph)[v].priority != 1) {
+                    std::cerr << "Error: " << options.objective << " games need priorities 0 or 1" << std::endl;
+                    return 1;
+                }
+            }
+        }
+
+        BatchSolver solve_batch;
+        if (options.engine == "bitboard") {
+            if (!bitboard::fits(*graph)) {
+                std::cerr << "Error: bitboard engine supports at most " << bitboard::max_vertices << " vertices" << std::endl;
+                return 1;
+            }
+            bitboard::with_mask_for(num_vertices, [&](auto mask) {
+                solve_batch = make_bitboard_solver<decltype(mask)>(*graph, options.objective, query);
+            });
+        } else if (options.engine == "interleaved") {
+            solve_batch = make_interleaved_solver(*graph, query, options.in_flight);
+        } else {
+            solve_batch = make_bitsliced_solver(*graph, options.objective, query);
+        }
+
+        std::vector<char> pinned(num_vertices, 0);
+        if (options.prefilter && options.perturbed()) {
+            std::cout << "Prefilter skipped: the arena is perturbed per sample" << std::endl;
+        } else if (options.prefilter) {
+            const auto forced = forced_outcome(*graph, options.objective, query);
+            if (forced.has_value()) {
+                std::cout << "Early termination: player " << (*forced ? 0 : 1) << " wins from " << options.vertex
+                          << " under every ownership" << std::endl;
+                std::cout << "Samples: 0" << std::endl;
+                std::cout << "Estimate: " << (*forced ? 1 : 0) << std::endl;
+                std::cout << "Standard error: 0" << std::endl;
+                return 0;
+            }
+
+            // Owners of irrelevant vertices are left with player 0 instead of being drawn
+            auto irrelevant = ggg::ownership::irrelevant_vertices(bitsliced::make_arena(*graph),
+                                                                  *ggg::ownership::parse_objective(options.objective));
+            std::cout << "Ownership-irrelevant vertices: " << irrelevant.count << " (bits not sampled)" << std::endl;
+            pinned = std::move(irrelevant.irrelevant);
+        }
+
+        if (options.estimator == "cross-entropy") {
+            return estimate_rare_event(options, *graph, query, pinned);
+        }
+
+        std::ofstream log;
+        if (!options.log.empty()) {
+            log.open(options.log);
+            if (!log.is_open()) {
+                std::cerr << "Error: Failed to open log file " << options.log << std::endl;
+                return 1;
+            }
+        }
+
+        std::unique_ptr<ggg::utils::SampleStoreWriter> store;
+        ggg::utils::SampleChunk chunk(num_vertices);
+        if (!options.store.empty()) {
+            store = std::make_unique<ggg::utils::SampleStoreWriter>(options.store, num_vertices, false);
+        }
+
+        std::unique_ptr<ggg::utils::SolutionCache> cache;
+        std::optional<SampleKeys> sample_keys;
+        std::array<ggg::utils::CacheKey, bitsliced::lane_count> keys;
+        if (!options.cache_dir.empty()) {
+            cache = std::make_unique<ggg::utils::SolutionCache>(options.cache_dir);
+            sample_keys.emplace(*graph, "sample/" + options.objective, query);
+        }
+
+        ggg::ownership::OwnershipDesign design(options.design, num_vertices, options.seed);
+        ggg::ownership::BlockEstimator estimator(design.block_size());
+        bitsliced::SlicedSet player1(num_vertices);
+        const auto arena = options.perturbed() ? bitsliced::make_arena(*graph) : bitsliced::Arena{};
+        std::seed_seq perturbation_seeds{options.seed, 1u};
+        std::mt19937_64 perturbation_rng(perturbation_seeds);
+        bitsliced::Overlay overlay;
+        long solved = 0;
+        long wins = 0;
+        double time_ms = 0.0;
+        long next_report = options.report_every;
+
+        while (solved < options.samples) {
+            const int batch = static_cast<int>(std::min<long>(bitsliced::lane_count, options.samples - solved));
+            const auto lanes = bitsliced::first_lanes(batch);
+            design.draw(player1, lanes, pinned);
+            if (options.edge_probability < 1.0) {
+                ggg::ownership::draw_edges(arena, options.edge_probability, perturbation_rng, overlay.present);
+            }
+            if (options.priority_jitter > 0) {
+                ggg::ownership::jitter_priorities(arena, options.priority_jitter, perturbation_rng, overlay);
+            }
+
+            const auto start = std::chrono::steady_clock::now();
+            // Lanes found in the cache are left out of the solve
+            bitsliced::Lanes open = lanes;
+            bitsliced::Lanes cached_wins = 0;
+            if (cache) {
+                for (int lane = 0; lane < batch; ++lane) {
+                    keys[lane] = (*sample_keys)(player1, lane);
+                    const auto hit = cache->lookup(keys[lane]);
+                    if (hit && hit->winners.size() == 1) {
+                        open &= ~(bitsliced::Lanes(1) << lane);
+                        cached_wins |= bitsliced::Lanes(hit->winners[0] == 0) << lane;
+                    }
+                }
+            }
+            auto won = open ? solve_batch(player1, open, options.perturbed() ? &overlay : nullptr) & open : 0;
+            if (cache) {
+                for (bitsliced::Lanes miss = open; miss; miss &= miss - 1) {
+                    const int lane = std::countr_zero(miss);
+                    cache->store(keys[lane], {{static_cast<std::int8_t>(((won >> lane) & 1) ? 0 : 1)}, {}, {}, {}});
+                }
+                won |= cached_wins;
+            }
+            const double batch_ms = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+            time_ms += batch_ms;
+
+            if (store) {
+                // Lanes share the batch time evenly
+                const auto time_us = static_cast<std::uint32_t>(std::lround(batch_ms * 1000.0 / batch));
+                for (int lane = 0; lane < batch; ++lane) {
+                    auto *owners = chunk.add_sample((won >> lane) & 1, time_us);
+                    for (int v = 0; v < num_vertices; ++v) {
+                        owners[v / 8] |= static_cast<std::uint8_t>((player1[v] >> lane) & 1) << (v % 8);
+                    }
+                }
+                if (chunk.size() >= store_chunk) {
+                    store->write(chunk);
+                    chunk.clear();
+                }
+            }
+
+            wins += std::popcount(won & lanes);
+            solved += batch;
+            estimator.add(won, batch);
+
+            if (options.report_every > 0 && solved >= next_report) {
+                std::cout << "Solved " << solved << "/" << options.samples << " | Agg: " << wins << "/" << solved
+                          << " | Time: " << std::fixed << std::setprecision(3) << time_ms << " ms" << std::endl;
+                if (log.is_open()) {
+                    log << wins << "/" << solved << "; " << std::fixed << std::setprecision(3) << time_ms << "\n";
+                    log.flush();
+                }
+                next_report = (solved / options.report_every + 1) * options.report_every;
+            }
+        }
+
+        if (store) {
+            store->write(chunk);
+            store->close();
+        }
+
+        estimator.finish();
+        std::cout << "Samples: " << solved << std::endl;
+        std::cout << "Player 0 wins from " << options.vertex << ": " << wins << std::endl;
+        report_estimate(options, estimator);
+        report_cache(cache.get());
+        std::cout << "Solver time: " << std::setprecision(3) << time_ms << " ms" << std::endl;
+        return 0;
+    }
+
+    /**
+     * @brief Cache keys of single samples
+     *
+     * A sample's key hashes the arena with every owner cleared (chance vertices keep
+     * player -1), the solver id and query vertex, then the sample's ownership bitstring.
+     * The arena part is hashed once and the hasher copied per sample.
+     */
+    class SampleKeys {
+      public:
+        template <typename GraphType>
+        SampleKeys(const GraphType &graph, const std::string &solver, std::size_t query) {
+            GraphType arena = graph;
+            for (const auto v : boost::make_iterator_range(boost::vertices(arena))) {
+                if (arena[v].player != -1) {
+                    arena[v].player = 0;
+                }
+            }
+            prefix_.add(ggg::utils::canonical_game(arena));
+            prefix_.add(solver + "/query=" + std::to_string(query));
+            owners_.resize((boost::num_vertices(arena) + 7) / 8);
+        }
+
+        /**
+         * @brief Key of the assignment in one lane
+         */
+        ggg::utils::CacheKey operator()(const bitsliced::SlicedSet &player1, int lane) {
+            std::fill(owners_.begin(), owners_.end(), 0);
+            for (std::size_t v = 0; v < player1.size(); ++v) {
+                owners_[v / 8] |= static_cast<std::uint8_t>((player1[v] >> lane) & 1) << (v % 8);
+            }
+            auto hasher = prefix_;
+            hasher.update(owners_.data(), owners_.size());
+            return hasher.key();
+        }
+
+      private:
+        ggg::utils::KeyHasher prefix_;
+        std::vector<std::uint8_t> owners_;
+    };
+
+    /**
+     * @brief Print the hits and stores of a solution cache, if one was used
+     */
+    static void report_cache(const ggg::utils::SolutionCache *cache) {
+        if (cache) {
+            std::cout << "Solution cache: " << cache->hits() << " hits, " << cache->stores() << " stored ("
+                      << cache->size() << " entries)" << std::endl;
+        }
+    }
+
+    /**
+     * @brief Run the cross-entropy rare-event estimator and print its report
+     */
+    static int estimate_rare_event(const Options &options, const ggg::graphs::ParityGraph &graph, int query,
+                                   const std::vector<char> &pinned) {
+        ggg::ownership::CrossEntropyOptions settings;
+        settings.level_samples = options.level_samples;
+        settings.final_samples = options.samples;
+        settings.rarity = options.rarity;
+
+        const auto start = std::chrono::steady_clock::now();
+        const auto result = ggg::ownership::cross_entropy_estimate(
+            bitsliced::make_arena(graph), *ggg::ownership::parse_objective(options.objective), query, pinned, settings,
+            options.seed);
+        const double time_ms = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+
+        std::cout << "Cross-entropy levels: " << result.levels << (result.reached ? "" : " (winning event not reached)") << std::endl;
+        std::cout << "Solves: " << result.solves << std::endl;
+        std::cout << "Samples: " << options.samples << std::endl;
+        std::cout << "Player 0 wins from " << options.vertex << ": " << result.hits << " (biased samples)" << std::endl;
+        std::cout << "Estimate: " << std::setprecision(6) << result.estimate << std::endl;
+        std::cout << "Standard error: " << result.standard_error << std::endl;
+        if (result.hits > 0) {
+            std::cout << "Relative error: " << result.relative_error << std::endl;
+        } else {
+            std::cout << "Relative error: n/a (no hits)" << std::endl;
+        }
+        std::cout << "Time: " << std::fixed << std::setprecision(3) << time_ms << " ms" << std::endl;
+        return 0;
+    }
+
+    /**
+     * @brief Print the estimate and its standard error
+     *
+     * I.i.d. runs report the binomial standard error; other designs report the
+     * between-block standard error and the design effect.
+     */
+    static void report_estimate(const Options &options, const ggg::ownership::BlockEstimator &estimator) {
+        const double estimate = estimator.estimate();
+        const double samples = static_cast<double>(estimator.samples());
+        std::cout << "Estimate: " << std::setprecision(6) << estimate << std::endl;
+        if (options.design == ggg::ownership::Design::Iid) {
+            std::cout << "Standard error: " << std::sqrt(estimate * (1.0 - estimate) / samples) << std::endl;
+            return;
+        }
+        std::cout << "Standard error: " << estimator.standard_error() << " (" << ggg::ownership::to_string(options.design)
+                  << " design, " << estimator.blocks() << " blocks)" << std::endl;
+        if (estimator.blocks() < 2) {
+            std::cout << "Design effect: unavailable (fewer than two blocks)" << std::endl;
+            return;
+        }
+        const double effect = estimator.design_effect();
+        std::cout << "Design effect: " << effect;
+        if (effect > 0.0) {
+            std::cout << " (worth " << std::llround(samples / effect) << " i.i.d. samples)";
+        }
+        std::cout << std::endl;
+    }
+
+    /**
+     * @brief Sample the query vertex's value under random ownership with a value solver
+     *
+     * Every thread owns a copy of the graph, a solver, a random generator seeded from the
+     * seed and the thread index, and a quantile sketch; the sketches are merged at the end.
+     * Discounted and stochastic discounted games share one Bellman system, solved for
+     * value_lanes::lane_count assignments per call unless --engine solver or
+     * --random-probabilities is given (the latter sweeps one Gauss-Seidel system per sample). Owner bits of chance vertices are cleared, so they
+     * keep player -1 and are stored as player 0.
+     */
+    template <typename GraphType, typename SolverType>
+    static int sample_values(const Options &options, const std::shared_ptr<GraphType> &graph) {
+        if (!graph) {
+            std::cerr << "Error: Failed to parse game from " << options.input << std::endl;
+            return 1;
+        }
+        const auto num_vertices = boost::num_vertices(*graph);
+        std::size_t query = num_vertices;
+        for (std::size_t v = 0; v < num_vertices; ++v) {
+            if ((*graph)[v].name == options.vertex) {
+                query = v;
+                break;
+            }
+        }
+        if (query == num_vertices) {
+            std::cerr << "Error: Vertex '" << options.vertex << "' not found in " << options.input << std::endl;
+            return 1;
+        }
+
+        constexpr bool stochastic = std::is_same_v<GraphType, ggg::graphs::Stochastic_DiscountedGraph>;
+        constexpr bool discounted = stochastic || std::is_same_v<GraphType, ggg::graphs::DiscountedGraph>;
+        const bool use_lanes = discounted && options.engine != "solver" && !options.random_probabilities;
+        ggg::solvers::BellmanSystem system;
+        if constexpr (discounted) {
+            if (use_lanes) {
+                system = SolverType::make_system(*graph);
+            }
+        }
+        std::vector<std::size_t> chance;
+        for (std::size_t v = 0; v < num_vertices; ++v) {
+            if ((*graph)[v].player == -1) {
+                chance.push_back(v);
+            }
+        }
+
+        struct Worker {
+            ggg::utils::KllSketch sketch;
+            ggg::ownership::BlockEstimator estimator;
+            double time_ms = 0.0;
+        };
+        const int threads = static_cast<int>(std::min<long>(options.threads, options.samples));
+        std::vector<Worker> workers(threads);
+        std::unique_ptr<ggg::utils::SampleStoreWriter> store;
+        if (!options.store.empty()) {
+            store = std::make_unique<ggg::utils::SampleStoreWriter>(options.store, num_vertices, true);
+        }
+        std::unique_ptr<ggg::utils::SolutionCache> cache;
+        std::optional<SampleKeys> sample_keys;
+        if (!options.cache_dir.empty()) {
+            cache = std::make_unique<ggg::utils::SolutionCache>(options.cache_dir);
+            sample_keys.emplace(*graph, "sample/" + options.objective + (use_lanes ? "/lanes" : "/solver"), query);
+        }
+        std::vector<std::thread> pool;
+        for (int t = 0; t < threads; ++t) {
+            pool.emplace_back([&, t]() {
+                auto &worker = workers[t];
+                GraphType game = *graph;
+                auto keys = sample_keys;
+                SolverType solver = [&]() {
+                    if constexpr (discounted) {
+                        if (options.engine != "solver") {
+                            // Redrawn probabilities change the system every sample, so each is swept on its own
+                            ggg::solvers::ValueIterationOptions sweep_options;
+                            sweep_options.method = ggg::solvers::ValueIterationMethod::GaussSeidel;
+                            return SolverType(sweep_options);
+                        }
+                    }
+                    return SolverType();
+                }();
+                std::seed_seq seeds{options.seed, static_cast<unsigned int>(t)};
+                std::array<std::uint32_t, 2> seed;
+                seeds.generate(seed.begin(), seed.end());
+                ggg::ownership::OwnershipDesign design(options.design, static_cast<int>(num_vertices),
+                                                      (std::uint64_t(seed[0]) << 32) | seed[1]);
+                worker.estimator = ggg::ownership::BlockEstimator(design.block_size());
+                bitsliced::SlicedSet player1;
+                std::mt19937_64 probability_rng((std::uint64_t(seed[1]) << 32) | seed[0]);
+                std::exponential_distribution<double> spacing;
+                const long samples = options.samples / threads + (t < options.samples % threads ? 1 : 0);
+                ggg::utils::SampleChunk chunk(num_vertices);
+
+                namespace value_lanes = ggg::solvers::value_lanes;
+                const ggg::solvers::ValueIterationOptions lane_options;
+                value_lanes::Owners lane_owners(use_lanes ? num_vertices : 0);
+                std::vector<double> lane_values;
+                std::array<double, value_lanes::lane_count> batch_values{};
+                double batch_ms = 0.0;
+
+                for (long i = 0; i < samples; ++i) {
+                    // Assignments are drawn a batch at a time and solved lane by lane, or
+                    // value_lanes::lane_count lanes at a time
+                    const int lane = static_cast<int>(i % bitsliced::lane_count);
+                    if (lane == 0) {
+                        design.draw(player1, bitsliced::first_lanes(static_cast<int>(std::min<long>(bitsliced::lane_count, samples - i))), {});
+                        for (const auto v : chance) {
+                            player1[v] = 0;
+                        }
+                    }
+                    if constexpr (stochastic) {
+                        if (options.random_probabilities) {
+                            // Normalised exponential spacings are uniform on the simplex
+                            for (const auto v : chance) {
+                                double total = 0.0;
+                                for (const auto edge : boost::make_iterator_range(boost::out_edges(v, game))) {
+                                    game[edge].probability = std::max(spacing(probability_rng), std::numeric_limits<double>::min());
+                                    total += game[edge].probability;
+                                }
+                                for (const auto edge : boost::make_iterator_range(boost::out_edges(v, game))) {
+                                    game[edge].probability /= total;
+                                }
+                            }
+                        }
+                    }
+
+                    double value = 0.0;
+                    bool won = false;
+                    double solve_ms = 0.0;
+                    if (use_lanes) {
+                        if (lane % value_lanes::lane_count == 0) {
+                            // The SIMD lanes are iterated together unless every one of them is cached
+                            std::array<ggg::utils::CacheKey, value_lanes::lane_count> lane_keys;
+                            int cached = 0;
+                            if (cache) {
+                                for (int l = 0; l < value_lanes::lane_count; ++l) {
+                                    lane_keys[l] = (*keys)(player1, lane + l);
+                                    const auto hit = cache->lookup(lane_keys[l]);
+                                    if (hit && hit->values.size() == 1) {
+                                        batch_values[l] = hit->values[0];
+                                        cached++;
+                                    }
+                                }
+                            }
+                            batch_ms = 0.0;
+                            if (cached < value_lanes::lane_count) {
+                                for (std::size_t v = 0; v < num_vertices; ++v) {
+                                    lane_owners[v] = static_cast<std::uint8_t>(player1[v] >> lane);
+                                }
+                                // Every batch starts from zero, so a sample's value does not depend on the batch before it
+                                lane_values.clear();
+                                const auto statistics = value_lanes::iterate(system, lane_owners, lane_options, lane_values);
+                                batch_ms = statistics.time_ms / value_lanes::lane_count;
+                                for (int l = 0; l < value_lanes::lane_count; ++l) {
+                                    batch_values[l] = lane_values[query * value_lanes::lane_count + l];
+                                    if (cache) {
+                                        cache->store(lane_keys[l], {{static_cast<std::int8_t>(batch_values[l] >= 0.0 ? 0 : 1)}, {}, {batch_values[l]}, {}});
+                                    }
+                                }
+                            }
+                        }
+                        value = batch_values[lane % value_lanes::lane_count];
+                        won = value >= 0.0; // As DiscountedValueSolver and StochasticDiscountedValueSolver
+                        solve_ms = batch_ms;
+                    } else {
+                        for (std::size_t v = 0; v < num_vertices; ++v) {
+                            if (game[v].player != -1) {
+                                game[v].player = static_cast<int>((player1[v] >> lane) & 1);
+                            }
+                        }
+                        ggg::utils::CacheKey key;
+                        std::optional<ggg::utils::CachedSolution> hit;
+                        if (cache) {
+                            key = (*keys)(player1, lane);
+                            hit = cache->lookup(key);
+                        }
+                        if (hit && hit->values.size() == 1) {
+                            value = hit->values[0];
+                            won = hit->winners[0] == 0;
+                        } else {
+                            const auto start = std::chrono::steady_clock::now();
+                            const auto solution = solver.solve(game);
+                            solve_ms = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+                            value = static_cast<double>(solution.get_value(query));
+                            won = solution.get_winning_player(query) == 0;
+                            if (cache) {
+                                cache->store(key, {{static_cast<std::int8_t>(won ? 0 : 1)}, {}, {value}, {}});
+                            }
+                        }
+                    }
+                    worker.time_ms += solve_ms;
+                    worker.sketch.update(value);
+                    worker.estimator.add(won ? 1 : 0, 1);
+
+                    if (store) {
+                        auto *owners = chunk.add_sample(won, static_cast<std::uint32_t>(std::lround(solve_ms * 1000.0)));
+                        for (std::size_t v = 0; v < num_vertices; ++v) {
+                            owners[v / 8] |= static_cast<std::uint8_t>((player1[v] >> lane) & 1) << (v % 8);
+                        }
+                        chunk.values.push_back(value);
+                        if (chunk.size() >= store_chunk) {
+                            store->write(chunk);
+                            chunk.clear();
+                        }
+                    }
+                }
+                if (store) {
+                    store->write(chunk);
+                }
+                worker.estimator.finish();
+            });
+        }
+        for (auto &thread : pool) {
+            thread.join();
+        }
+
+        if (store) {
+            store->close();
+        }
+
+        ggg::utils::KllSketch sketch;
+        ggg::ownership::BlockEstimator estimator;
+        double time_ms = 0.0;
+        for (const auto &worker : workers) {
+            sketch.merge(worker.sketch);
+            estimator.merge(worker.estimator);
+            time_ms += worker.time_ms;
+        }
+
+        std::cout << "Samples: " << options.samples << std::endl;
+        std::cout << "Player 0 wins from " << options.vertex << ": " << estimator.wins() << std::endl;
+        report_estimate(options, estimator);
+        report_cache(cache.get());
+        std::cout << "Value mean: " << sketch.mean() << std::endl;
+        std::cout << "Value range: [" << sketch.min() << ", " << sketch.max() << "]" << std::endl;
+        std::cout << "Value quantiles:";
+        for (const double q : {0.01, 0.05, 0.25, 0.5, 0.75, 0.95, 0.99}) {
+            std::cout << " q" << q << "=" << sketch.quantile(q);
+        }
+        std::cout << std::endl;
+
+        std::vector<double> edges;
+        for (int b = 0; b <= options.bins; ++b) {
+            edges.push_back(sketch.min() + (sketch.max() - sketch.min()) * b / options.bins);
+        }
+        const auto counts = sketch.histogram(edges);
+        std::cout << "Value histogram:" << std::endl;
+        for (int b = 0; b < options.bins; ++b) {
+            std::cout << "  " << (b == 0 ? "[" : "(") << edges[b] << ", " << edges[b + 1] << "]: "
+                      << std::llround(counts[b]) << std::endl;
+        }
+        std::cout << "Sketch items retained: " << sketch.retained() << std::endl;
+        std::cout << "Solver time: " << std::fixed << std::setprecision(3) << time_ms << " ms" << std::endl;
+        return 0;
+    }
+
+    /**
+     * @brief Decide whether the outcome at the query vertex is the same under every ownership
+     *
+     * Owning more vertices never hurts a player, so if player 0 wins while owning nothing
+     * the probability is 1, and if player 0 loses while owning everything it is 0. Both
+     * extremes are solved as two lanes of one bitsliced pass. For parity and Buchi
+     * objectives the argument needs every vertex to have a successor, so arenas with dead
+     * ends are not filtered.
+     *
+     * Before that, the priorities reachable from the query are computed in one
+     * multi-target pass (one lane per priority class) and reported, like the lasso checks
+     * of the experiment scripts.
+     *
+     * @return Winner-is-player-0 flag if the outcome is forced, empty otherwise
+     */
+    static std::optional<bool> forced_outcome(const ggg::graphs::ParityGraph &graph, const std::string &objective, int query) {
+        const auto arena = bitsliced::make_arena(graph);
+        const int n = arena.num_vertices;
+        const int classes = static_cast<int>(arena.priority_classes.size());
+
+        // Plain reachability is the player 0 attractor when player 0 owns everything
+        const std::vector<char> nobody(n, 0);
+        const std::vector<char> everywhere(n, 1);
+        if (classes <= bitsliced::lane_count) {
+            bitsliced::SlicedSet targets(n, 0);
+            for (int c = 0; c < classes; ++c) {
+                for (const int v : arena.priority_classes[c].second) {
+                    targets[v] |= bitsliced::Lanes(1) << c;
+                }
+            }
+            const auto reaching = bitsliced::attractors(arena, nobody, everywhere, targets, 0);
+            std::cout << graph[query].name << " can reach priorities:";
+            for (int c = classes - 1; c >= 0; --c) {
+                if ((reaching[query] >> c) & 1) {
+                    std::cout << " " << arena.priority_classes[c].first;
+                }
+            }
+            std::cout << std::endl;
+        }
+
+        if (objective != "reachability") {
+            for (int v = 0; v < n; ++v) {
+                if (arena.successor_offsets[v] == arena.successor_offsets[v + 1]) {
+                    return std::nullopt;
+                }
+            }
+        }
+
+        // Lane 0: player 0 owns every vertex, lane 1: player 1 owns every vertex
+        const bitsliced::SlicedSet player1(n, 0b10);
+        const auto won = make_bitsliced_solver(graph, objective, query)(player1, bitsliced::first_lanes(2), nullptr);
+        if ((won >> 1) & 1) {
+            return true;
+        }
+        if (!(won & 1)) {
+            return false;
+        }
+        return std::nullopt;
+    }
+
+    /**
+     * @brief Batch solver running all lanes at once with the bitsliced kernels
+     */
+    static BatchSolver make_bitsliced_solver(const ggg::graphs::ParityGraph &graph, const std::string &objective, int query) {
+        auto arena = std::make_shared<bitsliced::Arena>(bitsliced::make_arena(graph));
+        auto core = std::make_shared<bitsliced::SlicedSet>();
+        if (objective == "reachability") {
+            *core = bitsliced::reachability_core(*arena);
+        }
+        return [arena, core, objective, query](const bitsliced::SlicedSet &player1, bitsliced::Lanes lanes,
+                                               const bitsliced::Overlay *overlay) {
+            if (objective == "reachability") {
+                // The core survives dropped edges since every vertex keeps one (see draw_edges)
+                return bitsliced::solve_reachability_from(*arena, player1, lanes, *core, overlay)[query];
+            }
+            if (objective == "buchi") {
+                return bitsliced::solve_buchi(*arena, player1, lanes, overlay)[query];
+            }
+            return bitsliced::solve_parity(*arena, player1, lanes, nullptr, overlay)[query];
+        };
+    }
+
+    /**
+     * @brief Batch solver running one worklist reachability solve per lane, in_flight of them interleaved
+     *
+     * Each lane is one backward pass from the core that stops once the query is attracted,
+     * instead of whole-arena sweeps; meant for arenas far larger than the cache, where the
+     * interleaving hides the misses of the passes (overlays are not supported).
+     */
+    static BatchSolver make_interleaved_solver(const ggg::graphs::ParityGraph &graph, int query, int in_flight) {
+        auto arena = std::make_shared<bitsliced::Arena>(bitsliced::make_arena(graph));
+        auto core = std::make_shared<std::vector<int>>();
+        const auto core_lanes = bitsliced::reachability_core(*arena);
+        for (int v = 0; v < arena->num_vertices; ++v) {
+            if (core_lanes[v]) {
+                core->push_back(v);
+            }
+        }
+        auto workspaces = std::make_shared<std::vector<ggg::solvers::interleaved::Workspace>>(in_flight);
+        return [arena, core, workspaces, query, in_flight](const bitsliced::SlicedSet &player1, bitsliced::Lanes lanes,
+                                                           const bitsliced::Overlay *) {
+            std::array<int, bitsliced::lane_count> order;
+            int count = 0;
+            for (bitsliced::Lanes open = lanes; open; open &= open - 1) {
+                order[count++] = std::countr_zero(open);
+            }
+            std::array<bool, bitsliced::lane_count> won{};
+            ggg::solvers::interleaved::run(count, in_flight, [&](int index, int slot) {
+                return ggg::solvers::interleaved::reachability(*arena, player1, order[index], *core, query, (*workspaces)[slot],
+                                                               won[index]);
+            });
+            bitsliced::Lanes result = 0;
+            for (int index = 0; index < count; ++index) {
+                result |= bitsliced::Lanes(won[index]) << order[index];
+            }
+            return result;
+        };
+    }
+
+    /**
+     * @brief Batch solver running the bitboard kernels once per lane (overlays are not supported)
+     */
+    template <typename Mask>
+    static BatchSolver make_bitboard_solver(const ggg::graphs::ParityGraph &graph, const std::string &objective, int query) {
+        auto arena = std::make_shared<bitboard::Arena<Mask>>(bitboard::make_arena<Mask>(graph));
+        const Mask core = bitboard::attractor_core(*arena, arena->vertices, arena->with_priority(1));
+        return [arena, core, objective, query](const bitsliced::SlicedSet &player1, bitsliced::Lanes lanes, const bitsliced::Overlay *) {
+            bitsliced::Lanes won = 0;
+            for (int lane = 0; lane < bitsliced::lane_count; ++lane) {
+                if (!((lanes >> lane) & 1)) {
+                    continue;
+                }
+                Mask owners = 0;
+                for (int v = 0; v < arena->num_vertices; ++v) {
+                    owners |= Mask((player1[v] >> lane) & 1) << v;
+                }
+                Mask won0;
+                if (objective == "reachability") {
+                    won0 = bitboard::solve_reachability_from(*arena, owners, core);
+                } else if (objective == "buchi") {
+                    won0 = bitboard::solve_buchi(*arena, owners);
+                } else {
+                    won0 = bitboard::solve_parity(*arena, owners);
+                }
+                if (won0 & bitboard::bit<Mask>(query)) {
+                    won |= bitsliced::Lanes(1) << lane;
+                }
+            }
+            return won;
+        };
+    }
+};
+
+namespace ggg_tools {
+int run_sample_games(int argc, char *argv[]) {
+    return OwnershipSampler::run(argc, argv);
+}
+} // namespace ggg_tools